@@ -0,0 +1,137 @@
+/* fb.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _KERNEL_FB_H
+#define _KERNEL_FB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/gfx.h>
+
+#include <kernel/x86/multiboot2.h>
+
+/* Linear framebuffer set up from the multiboot2 framebuffer tag. The writers
+ * for the pixel format are picked once, when the framebuffer is set up, so the
+ * drawing primitives below never branch on the format per pixel. Pixels are
+ * passed already packed into the framebuffer's format, see fb_colour(). */
+
+struct fb_ops {
+    void (*put)(uint8_t *dst, uint32_t pixel);
+    void (*span)(uint8_t *dst, uint32_t pixel, size_t count);
+};
+
+/* At most this many damaged rectangles are kept, beyond that the closest
+ * pair is merged */
+#define FB_DAMAGE_MAX 8
+
+/* Indexed modes have at most 8 bits per pixel */
+#define FB_PALETTE_MAX 256
+
+struct fb_rect {
+    uint32_t x, y, w, h;
+};
+
+struct fb {
+    uint8_t *base;  /* Where drawing goes, the back buffer if there is one */
+    uint8_t *front; /* The framebuffer itself when double buffered */
+    uint64_t phys;
+    uint32_t pitch; /* Bytes from one row to the next */
+    uint32_t width;
+    uint32_t height;
+    uint8_t  bpp;
+    uint8_t  bytes; /* Per pixel */
+    uint8_t  type;  /* MULTIBOOT_FRAMEBUFFER_TYPE_* */
+
+    /* Field positions and widths for MULTIBOOT_FRAMEBUFFER_TYPE_RGB */
+    uint8_t red_pos, red_size;
+    uint8_t green_pos, green_size;
+    uint8_t blue_pos, blue_size;
+
+    /* The palette for MULTIBOOT_FRAMEBUFFER_TYPE_INDEXED, copied out of the
+     * multiboot information so that memory can be reused */
+    struct multiboot_color palette[FB_PALETTE_MAX];
+    uint16_t               palette_len;
+
+    /* Only set once fb_init() has succeeded, NULL while there is no screen */
+    const struct fb_ops *ops;
+
+    /* Regions of the back buffer not yet presented */
+    struct fb_rect damage[FB_DAMAGE_MAX];
+    unsigned       damage_len;
+};
+
+extern struct fb fb_screen;
+
+/* Set up fb_screen from the tag and map it write-combining. Fails for EGA
+ * text, which is left to the VGA console, for pixel sizes with no writers
+ * and if the framebuffer cannot be mapped, leaving fb_screen.ops NULL. */
+int fb_init(const struct multiboot_tag_framebuffer *tag);
+
+/* Draw into back, a buffer of pitch * height bytes in ordinary memory, from
+ * now on, starting from what is on screen. Reads are then cheap, and
+ * nothing reaches the screen until fb_present(). */
+int fb_set_back(struct fb *fb, void *back);
+
+/* Note a region as changed. The drawing below does this itself, code writing
+ * through fb->base directly has to call it. A no-op when single buffered. */
+void fb_damage(struct fb *fb, uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+
+/* Copy the damaged rows of the back buffer to the screen with streaming
+ * stores, so the cost follows what changed rather than the screen size */
+void fb_present(struct fb *fb);
+
+/* `fbbench` on the kernel command line makes fb_bench() time full-screen
+ * fills with the mapping of fb switched to uncached and write-combining, and
+ * draw_moire() on fb_screen */
+void fb_parse_cmdline(const char *cmdline);
+void fb_bench(struct fb *fb);
+
+/* Pack an RGB colour into the pixel format of fb. Indexed formats get the
+ * closest palette entry. */
+uint32_t fb_colour(const struct fb *fb, uint8_t r, uint8_t g, uint8_t b);
+
+/* Describe what fb draws into as a surface for the 2D operations of
+ * <sys/gfx.h>, which leave noting the damage to the caller. Fails for
+ * layouts gfx has no format for, indexed colour among them. */
+int fb_surface(const struct fb *fb, struct gfx_surface *s);
+
+/* Drawing, clipped to the framebuffer. fb_blit() copies rows already in the
+ * framebuffer's pixel format, src_pitch bytes apart. */
+void fb_put(struct fb *fb, uint32_t x, uint32_t y, uint32_t pixel);
+void fb_span(struct fb *fb, uint32_t x, uint32_t y, uint32_t len,
+             uint32_t pixel);
+void fb_fill(struct fb *fb, uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+             uint32_t pixel);
+void fb_blit(struct fb *fb, uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+             const void *src, size_t src_pitch);
+
+#endif /* _KERNEL_FB_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,61 @@
+/* fbterm.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _KERNEL_FBTERM_H
+#define _KERNEL_FBTERM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <kernel/fb.h>
+#include <kernel/psf.h>
+
+/* Text terminal on a linear framebuffer. Writes only update a grid of cells,
+ * a codepoint and a VGA colour attribute each, and scrolling only rotates
+ * the grid's ring of rows. At the end of every write the grid is compared
+ * with what was last drawn: the scroll since then becomes one block move of
+ * the screen and only the cells that still differ are drawn. Registered as
+ * the "fbterm" console, so "console=fbterm" sends printf() here alone. */
+
+#define FBTERM_COLS_MAX 256
+#define FBTERM_ROWS_MAX 128
+
+/* Take over fb with font. Fails if the font does not fit the glyph cache. */
+int fbterm_init(struct fb *fb, const struct psf_font *font);
+
+/* UTF-8 text with \n, \r, \t, \b and the SGR colour escapes */
+void fbterm_write(const char *data, size_t size);
+
+/* Colour for text from now on and for SGR 0, see vga_entry_colour() */
+void fbterm_setcolour(uint8_t attr);
+
+#endif /* _KERNEL_FBTERM_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -31,9 +31,12 @@
 #ifndef _KERNEL_PSF_H
 #define _KERNEL_PSF_H
 
+#include <stddef.h>
 #include <stdint.h>
 
-#define PSF1_MAGIC 0x3604
+#include <kernel/fb.h>
+
+#define PSF1_MAGIC 0x0436 /* The bytes 36 04, read little-endian */
 #define PSF1_WIDTH 0x01
 
 enum psf1_font_mode {
@@ -43,11 +46,93 @@ enum psf1_font_mode {
 };
 
 typedef struct {
-    uint16_t            magic;
-    enum psf1_font_mode font_mode;
-    uint8_t             glyph_size;
+    uint16_t magic;
+    uint8_t  font_mode; /* enum psf1_font_mode */
+    uint8_t  glyph_size;
 } psf1_header_t;
 
+#define PSF2_MAGIC             0x864AB572
+#define PSF2_HAS_UNICODE_TABLE 0x01
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size; /* Offset of the glyphs */
+    uint32_t flags;
+    uint32_t length;      /* Number of glyphs */
+    uint32_t glyph_size;  /* Bytes per glyph */
+    uint32_t height;
+    uint32_t width;
+} psf2_header_t;
+
+/* In the Unicode table, a glyph's entry ends at the terminator and the
+ * sequences after the start marker are skipped */
+#define PSF1_TABLE_SEQ  0xFFFE
+#define PSF1_TABLE_TERM 0xFFFF
+#define PSF2_TABLE_SEQ  0xFE
+#define PSF2_TABLE_TERM 0xFF
+
+/* Codepoint to glyph map built from a font's Unicode table. The BMP is
+ * looked up directly, the rest through a small open-addressed hash. */
+#define PSF_NO_GLYPH     0xFFFF
+#define PSF_ASTRAL_SLOTS 256
+
+struct psf_unimap {
+    uint16_t bmp[0x10000];
+    struct {
+        uint32_t cp;
+        uint16_t glyph;
+    } astral[PSF_ASTRAL_SLOTS];
+    uint16_t fallback; /* For codepoints the font has no glyph for */
+};
+
+/* Glyph bitmaps of a loaded font, rows of row_bytes with the leftmost pixel
+ * in the top bit */
+struct psf_font {
+    const uint8_t *glyphs;
+    uint32_t       count;
+    uint32_t       width;
+    uint32_t       height;
+    uint32_t       row_bytes;
+    uint32_t       glyph_bytes;
+
+    /* The Unicode table, NULL if the font has none, UTF-8 for PSF2 and
+     * little-endian UCS-2 for PSF1 */
+    const uint8_t *table;
+    const uint8_t *table_end;
+    uint8_t        table_utf8;
+
+    const struct psf_unimap *map;
+};
+
+/* The font built into the kernel, 512 8x9 glyphs */
+extern struct psf_font psf_default;
+
+/* Parse a PSF1 or PSF2 font from data. Fails on a bad magic or truncated
+ * data. */
+int psf_load(struct psf_font *font, const void *data, size_t len);
+
+/* Build map from the font's Unicode table and look codepoints up through it
+ * from then on. Without a map a codepoint is taken as the glyph index. */
+int psf_map(struct psf_font *font, struct psf_unimap *map);
+
+/* The glyph for codepoint cp */
+uint32_t psf_lookup(const struct psf_font *font, uint32_t cp);
+
+/* Draw text on fb with font from now on. Glyphs are expanded into the pixel
+ * format of fb the first time they are drawn in a colour pair and copied a
+ * row at a time after that, so this must be called again after a mode set.
+ * Fails if a single colour pair of the font does not fit the cache. */
+int psf_init(struct fb *fb, const struct psf_font *font);
+
+/* Colours already packed for the framebuffer, see fb_colour() */
+void psf_setcolour(uint32_t fg, uint32_t bg);
+
+/* Draw glyph at the text cell col, row */
+void psf_putglyph(uint32_t col, uint32_t row, uint32_t glyph);
+
+/* Write the UTF-8 string str at the cursor, wrapping and scrolling, and
+ * return the number of characters written */
 int pfs_puts(const char *str);
 
 #endif /* _KERNEL_PSF_H */
@@ -0,0 +1,59 @@
+/* serial.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _KERNEL_SERIAL_H
+#define _KERNEL_SERIAL_H
+
+#include <stddef.h>
+
+/* COM1 console. Writes wait on the line until the COM1 interrupt is wired
+ * up. From then on output is copied into a transmit ring and fed to the
+ * UART's FIFO from the transmitter-empty interrupt, so writers never wait.
+ * Writers must not run concurrently with each other. */
+
+int  serial_init(void);
+void serial_write(const char *data, size_t size);
+void serial_putchar(char c);
+
+/* Body of the COM1 interrupt handler */
+void serial_intr(void);
+
+/* Switch writes over to the ring, for once IRQ4 reaches serial_intr() */
+void serial_intr_enable(void);
+
+/* Wait for everything queued to reach the line */
+void serial_drain(void);
+
+/* Stop using the interrupt, every write from here on waits on the line */
+void serial_panic(void);
+
+#endif /* _KERNEL_SERIAL_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
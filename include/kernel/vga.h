@@ -65,9 +65,17 @@ static inline uint16_t vga_entry(unsigned char c, uint8_t colour)
 void vga_init(void);
 void vga_clear(void);
 void vga_set_addr(uint16_t *);
+void vga_set_window(uint16_t *addr, size_t size);
+void vga_scrollback(size_t rows);
 
 void vga_setcolour(uint8_t fg, uint8_t bg);
 
+/* Apply the parameters of an SGR sequence, ESC [ ... m, to the attribute
+ * byte attr. 0, 39 and 49 go back to base, no parameters at all is a 0.
+ * Shared by every console that speaks in VGA attributes. */
+uint8_t vga_sgr_attr(uint8_t attr, uint8_t base, const uint16_t *param,
+                     size_t count);
+
 void vga_scroll(int line);
 void vga_delete_line(int line);
 void vga_delete_last_line(void);
@@ -76,6 +84,7 @@ void vga_putentry(unsigned char c, uint8_t colour, size_t x, size_t y);
 void vga_putchar(char c);
 void vga_write(const char *data, size_t size);
 void vga_writes(const char *data);
+void vga_flush(void);
 
 #endif /* _KERNEL_VGA_H */
 
@@ -0,0 +1,107 @@
+/* cpu.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _KERNEL_X86_CPU_H
+#define _KERNEL_X86_CPU_H
+
+#include <stdint.h>
+
+/* CPUID leaf 0x00000001 */
+#define CPUID_1_EDX_PAT     (1u << 16)
+#define CPUID_1_EDX_SSE2    (1u << 26)
+#define CPUID_1_ECX_SSSE3   (1u << 9)
+#define CPUID_1_ECX_POPCNT  (1u << 23)
+#define CPUID_1_ECX_XSAVE   (1u << 26)
+#define CPUID_1_ECX_OSXSAVE (1u << 27)
+#define CPUID_1_ECX_AVX     (1u << 28)
+
+/* CPUID leaf 0x00000007 subleaf 0 */
+#define CPUID_7_EBX_AVX2 (1u << 5)
+#define CPUID_7_EBX_BMI2 (1u << 8)
+#define CPUID_7_EBX_ERMS (1u << 9)
+#define CPUID_7_EDX_FSRM (1u << 4)
+
+#define CR4_OSFXSR     (1ul << 9)
+#define CR4_OSXMMEXCPT (1ul << 10)
+#define CR4_OSXSAVE    (1ul << 18)
+
+#define MSR_IA32_PAT 0x277
+
+#define XCR0_X87 (1u << 0)
+#define XCR0_SSE (1u << 1)
+#define XCR0_AVX (1u << 2)
+
+/* Features the kernel and libk select code paths on. AVX and AVX2 are only
+ * reported once the register state has been enabled through XCR0. */
+enum cpu_feature {
+    CPU_FEATURE_SSE2   = 1 << 0,
+    CPU_FEATURE_SSSE3  = 1 << 1,
+    CPU_FEATURE_POPCNT = 1 << 2,
+    CPU_FEATURE_AVX    = 1 << 3,
+    CPU_FEATURE_AVX2   = 1 << 4,
+    CPU_FEATURE_BMI2   = 1 << 5,
+    CPU_FEATURE_ERMS   = 1 << 6,
+    CPU_FEATURE_FSRM   = 1 << 7,
+};
+
+extern uint32_t cpu_features;
+
+static inline int cpu_has(enum cpu_feature f) { return (cpu_features & f) != 0; }
+
+static inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t *a,
+                         uint32_t *b, uint32_t *c, uint32_t *d)
+{
+    __asm__ volatile("cpuid"
+                     : "=a"(*a), "=b"(*b), "=c"(*c), "=d"(*d)
+                     : "a"(leaf), "c"(subleaf));
+}
+
+static inline uint64_t rdmsr(uint32_t msr)
+{
+    uint32_t lo, hi;
+    __asm__ volatile("rdmsr" : "=a"(lo), "=d"(hi) : "c"(msr));
+    return (( uint64_t )hi << 32) | lo;
+}
+
+static inline void wrmsr(uint32_t msr, uint64_t val)
+{
+    __asm__ volatile("wrmsr"
+                     :
+                     : "c"(msr), "a"(( uint32_t )val),
+                       "d"(( uint32_t )(val >> 32)));
+}
+
+void cpu_init(void);
+void cpu_parse_cmdline(const char *cmdline);
+void cpu_print_features(void);
+
+#endif /* _KERNEL_X86_CPU_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,83 @@
+/* paging.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _KERNEL_X86_PAGING_H
+#define _KERNEL_X86_PAGING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PAGE_SIZE    0x1000ul
+#define PAGE_SIZE_2M 0x200000ul
+
+/* The kernel image is linked 3 GiB above where it is loaded, see linker.ld */
+#define KERNEL_VMA_OFFSET 0xC0000000ul
+
+/* Page table entry bits */
+#define PTE_P        (1ul << 0)
+#define PTE_W        (1ul << 1)
+#define PTE_PWT      (1ul << 3)
+#define PTE_PCD      (1ul << 4)
+#define PTE_PS       (1ul << 7)  /* Page directory entries, 2 MiB page */
+#define PTE_PAT      (1ul << 7)  /* Page table entries */
+#define PTE_PAT_2M   (1ul << 12) /* 2 MiB pages */
+#define PTE_ADDR     0x000FFFFFFFFFF000ul
+#define PTE_ADDR_2M  0x000FFFFFFFE00000ul
+
+/* Memory types for map_region(). WB for RAM, WC for framebuffers and other
+ * memory that is only streamed to, UC for device registers that must see
+ * every access in order, WT for memory read back often but written by the
+ * CPU alone. */
+enum cache_type {
+    CACHE_WB,
+    CACHE_WT,
+    CACHE_UC,
+    CACHE_WC,
+};
+
+/* Program IA32_PAT so every cache_type has a PAT entry. Without PAT, WC
+ * mappings fall back to UC. */
+void paging_init(void);
+
+/* Map len bytes of physical memory at phys with the given memory type and
+ * return the address it can be reached at, or NULL if the window for device
+ * mappings or the page tables backing it have run out. Aligned 2 MiB runs
+ * use large pages. */
+void *map_region(uint64_t phys, size_t len, enum cache_type type);
+
+/* Change the memory type of len bytes already mapped at addr, in place.
+ * Mapping memory a second time with another type instead would alias it,
+ * which the SDM leaves undefined. Fails if part of the range is unmapped,
+ * having changed the part before it. */
+int map_retype(void *addr, size_t len, enum cache_type type);
+
+#endif /* _KERNEL_X86_PAGING_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -31,13 +31,15 @@
 #ifndef _STDARG_H
 #define _STDARG_H
 
-typedef struct va_list {
-    unsigned char *cur;
-} va_list;
+/* The x86_64 calling convention passes variadic arguments in registers, so
+ * they cannot be found by walking up from the last named parameter. Let the
+ * compiler do it. */
+typedef __builtin_va_list va_list;
 
-#define va_start(a, last) ((a).cur = ( unsigned char * )(&(last)))
-#define va_arg(a, type)   (*(( type * )((a).cur = (a).cur + sizeof(type))))
-#define va_end(a)         ((a).cur = NULL)
+#define va_start(a, last) __builtin_va_start(a, last)
+#define va_arg(a, type)   __builtin_va_arg(a, type)
+#define va_end(a)         __builtin_va_end(a)
+#define va_copy(d, s)     __builtin_va_copy(d, s)
 
 #endif /* _STDARG_H */
 
@@ -0,0 +1,297 @@
+/* fbterm.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/console.h>
+
+#include <kernel/fb.h>
+#include <kernel/fbterm.h>
+#include <kernel/psf.h>
+#include <kernel/vga.h>
+
+/* A cell is the codepoint in the low 24 bits and the attribute above. No
+ * codepoint reaches 0xFFFFFF, so CELL_UNKNOWN marks cells the screen holds
+ * nothing known for. */
+#define CELL(cp, attr)  (( uint32_t )(cp) | ( uint32_t )(attr) << 24)
+#define CELL_CP(cell)   ((cell) & 0xFFFFFF)
+#define CELL_ATTR(cell) (( uint8_t )((cell) >> 24))
+#define CELL_UNKNOWN    0xFFFFFFFF
+
+#define TAB_WIDTH 8
+
+/* The 16 VGA colours, in the order of enum vga_colour's attribute bits */
+static const uint8_t fbterm_rgb[16][3] = {
+        {0x00, 0x00, 0x00},
+        {0x00, 0x00, 0xAA},
+        {0x00, 0xAA, 0x00},
+        {0x00, 0xAA, 0xAA},
+        {0xAA, 0x00, 0x00},
+        {0xAA, 0x00, 0xAA},
+        {0xAA, 0x55, 0x00},
+        {0xAA, 0xAA, 0xAA},
+        {0x55, 0x55, 0x55},
+        {0x55, 0x55, 0xFF},
+        {0x55, 0xFF, 0x55},
+        {0x55, 0xFF, 0xFF},
+        {0xFF, 0x55, 0x55},
+        {0xFF, 0x55, 0xFF},
+        {0xFF, 0xFF, 0x55},
+        {0xFF, 0xFF, 0xFF},
+};
+
+/* The grid is a ring of rows with screen row 0 at fbterm_top, shown is in
+ * screen order. Dirty marks ring rows written since the last flush. */
+static uint32_t fbterm_grid[FBTERM_ROWS_MAX][FBTERM_COLS_MAX];
+static uint32_t fbterm_shown[FBTERM_ROWS_MAX][FBTERM_COLS_MAX];
+static uint8_t  fbterm_dirty[FBTERM_ROWS_MAX];
+
+static struct fb             *fbterm_fb;
+static const struct psf_font *fbterm_font;
+static uint32_t               fbterm_palette[16];
+static uint32_t               fbterm_cols, fbterm_rows;
+static uint32_t               fbterm_col, fbterm_row, fbterm_top;
+static uint32_t               fbterm_scrolled; /* Rows since the last flush */
+static uint8_t                fbterm_attr = 0x07, fbterm_base = 0x07;
+
+/* Input state, UTF-8 sequences and escapes may be split across writes */
+enum { ST_TEXT, ST_ESC, ST_CSI };
+
+static int      fbterm_state = ST_TEXT;
+static uint32_t fbterm_cp;
+static int      fbterm_more;
+static uint16_t fbterm_params[4];
+static unsigned fbterm_nparams;
+
+static void fbterm_clear_row(uint32_t ring)
+{
+    for (uint32_t c = 0; c < fbterm_cols; ++c)
+        fbterm_grid[ring][c] = CELL(' ', fbterm_attr);
+    fbterm_dirty[ring] = 1;
+}
+
+static void fbterm_newline(void)
+{
+    fbterm_col = 0;
+    if (++fbterm_row < fbterm_rows)
+        return;
+
+    /* The old top row comes round as the new bottom one */
+    fbterm_row = fbterm_rows - 1;
+    fbterm_clear_row(fbterm_top);
+    fbterm_top = (fbterm_top + 1) % fbterm_rows;
+    if (fbterm_scrolled < fbterm_rows)
+        ++fbterm_scrolled;
+}
+
+static void fbterm_put(uint32_t cp)
+{
+    uint32_t ring;
+
+    if (fbterm_col == fbterm_cols)
+        fbterm_newline();
+    ring                            = (fbterm_top + fbterm_row) % fbterm_rows;
+    fbterm_grid[ring][fbterm_col++] = CELL(cp, fbterm_attr);
+    fbterm_dirty[ring]              = 1;
+}
+
+static void fbterm_control(uint8_t c)
+{
+    switch (c) {
+    case '\n':
+        fbterm_newline();
+        break;
+    case '\r':
+        fbterm_col = 0;
+        break;
+    case '\t':
+        while (fbterm_col < fbterm_cols && (fbterm_col + 1) % TAB_WIDTH)
+            fbterm_put(' ');
+        if (fbterm_col < fbterm_cols)
+            fbterm_put(' ');
+        break;
+    case '\b':
+        if (fbterm_col)
+            --fbterm_col;
+        break;
+    case 0x1B:
+        fbterm_state = ST_ESC;
+        break;
+    }
+}
+
+static void fbterm_byte(uint8_t c)
+{
+    switch (fbterm_state) {
+    case ST_ESC:
+        fbterm_state   = c == '[' ? ST_CSI : ST_TEXT;
+        fbterm_nparams = 0;
+        return;
+    case ST_CSI:
+        if (c >= '0' && c <= '9') {
+            if (!fbterm_nparams)
+                fbterm_params[fbterm_nparams++] = 0;
+            if (fbterm_params[fbterm_nparams - 1] < 10000)
+                fbterm_params[fbterm_nparams - 1] = ( uint16_t )(
+                        fbterm_params[fbterm_nparams - 1] * 10 + (c - '0'));
+        } else if (c == ';') {
+            if (!fbterm_nparams)
+                fbterm_params[fbterm_nparams++] = 0;
+            if (fbterm_nparams < 4)
+                fbterm_params[fbterm_nparams++] = 0;
+        } else if (c >= 0x40 && c <= 0x7E) {
+            /* Colours are all a log needs, other sequences are dropped */
+            if (c == 'm')
+                fbterm_attr = vga_sgr_attr(fbterm_attr, fbterm_base,
+                                           fbterm_params, fbterm_nparams);
+            fbterm_state = ST_TEXT;
+        }
+        return;
+    }
+
+    if (fbterm_more) {
+        if ((c & 0xC0) == 0x80) {
+            fbterm_cp = (fbterm_cp << 6) | (c & 0x3F);
+            if (!--fbterm_more)
+                fbterm_put(fbterm_cp);
+            return;
+        }
+        fbterm_more = 0;
+        fbterm_put(0xFFFD);
+    }
+
+    if (c < 0x20)
+        fbterm_control(c);
+    else if (c < 0x80)
+        fbterm_put(c);
+    else if ((c & 0xE0) == 0xC0)
+        fbterm_cp = c & 0x1F, fbterm_more = 1;
+    else if ((c & 0xF0) == 0xE0)
+        fbterm_cp = c & 0x0F, fbterm_more = 2;
+    else if ((c & 0xF8) == 0xF0)
+        fbterm_cp = c & 0x07, fbterm_more = 3;
+    else
+        fbterm_put(0xFFFD);
+}
+
+/* Bring the screen up to the grid. Rows scrolled off since the last flush
+ * are dropped with one move of the rest of the screen, then only the cells
+ * that differ from what is shown are drawn. */
+static void fbterm_flush(void)
+{
+    struct fb *fb     = fbterm_fb;
+    uint32_t   rows   = fbterm_rows;
+    uint32_t   height = fbterm_font->height;
+
+    if (fbterm_scrolled) {
+        uint32_t k    = fbterm_scrolled;
+        size_t   line = ( size_t )height * fb->pitch;
+
+        if (k < rows) {
+            memmove(fb->base, fb->base + k * line, (rows - k) * line);
+            memmove(fbterm_shown[0], fbterm_shown[k],
+                    (rows - k) * sizeof(fbterm_shown[0]));
+            fb_damage(fb, 0, 0, fb->width, (rows - k) * height);
+        }
+        memset(fbterm_shown[rows - k], 0xFF, k * sizeof(fbterm_shown[0]));
+        fbterm_scrolled = 0;
+    }
+
+    for (uint32_t r = 0; r < rows; ++r) {
+        uint32_t  ring  = (fbterm_top + r) % rows;
+        uint32_t *cells = fbterm_grid[ring], *shown = fbterm_shown[r];
+
+        if (!fbterm_dirty[ring] && shown[0] != CELL_UNKNOWN)
+            continue;
+        fbterm_dirty[ring] = 0;
+
+        for (uint32_t c = 0; c < fbterm_cols; ++c) {
+            uint32_t cell = cells[c];
+            if (cell == shown[c])
+                continue;
+            shown[c] = cell;
+            psf_setcolour(fbterm_palette[CELL_ATTR(cell) & 0x0F],
+                          fbterm_palette[CELL_ATTR(cell) >> 4]);
+            psf_putglyph(c, r, psf_lookup(fbterm_font, CELL_CP(cell)));
+        }
+    }
+
+    fb_present(fb);
+}
+
+void fbterm_write(const char *data, size_t size)
+{
+    if (!fbterm_fb)
+        return;
+    for (size_t i = 0; i < size; ++i)
+        fbterm_byte(( uint8_t )data[i]);
+    fbterm_flush();
+}
+
+void fbterm_setcolour(uint8_t attr)
+{
+    fbterm_attr = fbterm_base = attr;
+}
+
+static struct console fbterm_console = {.name  = "fbterm",
+                                        .write = fbterm_write};
+
+int fbterm_init(struct fb *fb, const struct psf_font *font)
+{
+    if (psf_init(fb, font))
+        return -1;
+
+    fbterm_fb   = fb;
+    fbterm_font = font;
+    fbterm_cols = fb->width / font->width;
+    fbterm_rows = fb->height / font->height;
+    if (fbterm_cols > FBTERM_COLS_MAX)
+        fbterm_cols = FBTERM_COLS_MAX;
+    if (fbterm_rows > FBTERM_ROWS_MAX)
+        fbterm_rows = FBTERM_ROWS_MAX;
+    if (!fbterm_cols || !fbterm_rows)
+        return -1;
+
+    for (unsigned i = 0; i < 16; ++i)
+        fbterm_palette[i] = fb_colour(fb, fbterm_rgb[i][0], fbterm_rgb[i][1],
+                                      fbterm_rgb[i][2]);
+
+    fbterm_top = fbterm_col = fbterm_row = fbterm_scrolled = 0;
+    for (uint32_t r = 0; r < fbterm_rows; ++r)
+        fbterm_clear_row(r);
+    memset(fbterm_shown, 0xFF, sizeof(fbterm_shown));
+    fbterm_flush();
+
+    console_register(&fbterm_console);
+    return 0;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -30,24 +30,110 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/console.h>
+#include <sys/kprint.h>
 
+#include <kernel/debugcon.h>
+#include <kernel/fb.h>
+#include <kernel/fbterm.h>
+#include <kernel/x86/cpu.h>
 #include <kernel/x86/multiboot2.h>
+#include <kernel/x86/paging.h>
 #include <kernel/psf.h>
+#include <kernel/serial.h>
 #include <kernel/vga.h>
 #include <kernel/vesa.h>
 
+/* Free memory below this is left alone when looking for a back buffer */
+#define BACK_BUFFER_FLOOR 0x1000000
+
+/* Memory the boot loader may have put anywhere in the free runs, the
+ * multiboot information and the boot modules, which the back buffer has to
+ * stay clear of. With more modules than fit there is no back buffer. */
+#define BOOT_RESERVED_MAX 16
+
+struct phys_range {
+    uint64_t start, end;
+};
+
+static struct phys_range boot_reserved[BOOT_RESERVED_MAX];
+static size_t            boot_reserved_len;
+static int               boot_reserved_full;
+
+static void boot_reserve(uint64_t start, uint64_t end)
+{
+    if (boot_reserved_len == BOOT_RESERVED_MAX)
+        boot_reserved_full = 1;
+    else
+        boot_reserved[boot_reserved_len++] = (struct phys_range){start, end};
+}
+
+static uint64_t page_up(uint64_t a)
+{
+    return (a + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+}
+
+/* The lowest page aligned place for len bytes in the free run [start, end)
+ * above BACK_BUFFER_FLOOR that misses every reserved range, or 0. Each
+ * collision moves the candidate past the range it hit. */
+static uint64_t back_buffer_fit(uint64_t start, uint64_t end, uint64_t len)
+{
+    uint64_t base = page_up(start > BACK_BUFFER_FLOOR ? start
+                                                      : BACK_BUFFER_FLOOR);
+
+    for (size_t i = 0; i < boot_reserved_len && base + len <= end;) {
+        const struct phys_range *r = &boot_reserved[i];
+        if (r->start < base + len && r->end > base) {
+            base = page_up(r->end);
+            i    = 0;
+        } else {
+            ++i;
+        }
+    }
+    return base + len <= end ? base : 0;
+}
+
+/* The first fit for len bytes among the free runs of the memory map */
+static uint64_t back_buffer_place(struct multiboot_tag_mmap *tag, uint64_t len)
+{
+    multiboot_memory_map_t *mmap;
+    uint64_t                base;
+
+    if (boot_reserved_full)
+        return 0;
+    for (mmap = tag->entries;
+         ( multiboot_uint8_t * )mmap < ( multiboot_uint8_t * )tag + tag->size;
+         mmap = ( multiboot_memory_map_t * )(( multiboot_uint8_t * )mmap +
+                                              tag->entry_size))
+        if (mmap->type == MULTIBOOT_MEMORY_AVAILABLE &&
+            (base = back_buffer_fit(mmap->addr, mmap->addr + mmap->len, len)))
+            return base;
+    return 0;
+}
+
 void kernel_entry(uint32_t magic, uint32_t addr);
 
 void kernel_entry(uint32_t magic, uint32_t addr)
 {
+    cpu_init();
+    paging_init();
+    /* boot.S identity maps the low memory, so all 32 KiB of text memory is
+     * reachable and the console can scroll through it in hardware */
+    vga_set_window(( uint16_t * )0xB8000, 0x8000);
     vga_init();
+    serial_init();
+    debugcon_init();
+    /* The banner goes straight to the screen, the log has no colours */
     vga_setcolour(VGA_COLOUR_BLACK, VGA_COLOUR_WHITE);
-    printf("                                    aionOS                    "
-           "                \n");
+    vga_writes("                                    aionOS                    "
+               "                \n");
     vga_setcolour(VGA_COLOUR_WHITE, VGA_COLOUR_BLACK);
 
-    struct multiboot_tag *tag;
-    size_t                size;
+    struct multiboot_tag      *tag;
+    struct multiboot_tag_mmap *mmap_tag = NULL;
+    size_t                     size;
+    uint64_t                   back_phys = 0;
+    int                        fb_up     = 0;
 
     if (magic != MULTIBOOT2_BOOTLOADER_MAGIC) {
         printf("[multiboot2] Invalid magic number: 0x%x\n", ( unsigned )magic);
@@ -59,6 +145,8 @@ void kernel_entry(uint32_t magic, uint32_t addr)
         abort();
     }
 
+    boot_reserve(addr, addr + *( multiboot_uint32_t * )( uintptr_t )addr);
+
     size = ( uintptr_t )addr;
     printf("[multiboot2] Announced mbi size 0x%x\n", ( unsigned int )size);
     for (tag = ( struct multiboot_tag * )( uintptr_t )(addr + 8);
@@ -72,6 +160,10 @@ void kernel_entry(uint32_t magic, uint32_t addr)
         case MULTIBOOT_TAG_TYPE_CMDLINE:
             printf("[multiboot2] Command line = %s\n",
                    (( struct multiboot_tag_string * )tag)->string);
+            cpu_parse_cmdline((( struct multiboot_tag_string * )tag)->string);
+            console_parse_cmdline(
+                    (( struct multiboot_tag_string * )tag)->string);
+            fb_parse_cmdline((( struct multiboot_tag_string * )tag)->string);
             break;
         case MULTIBOOT_TAG_TYPE_BOOT_LOADER_NAME:
             printf("[multiboot2] Boot loader name = %s\n",
@@ -83,6 +175,8 @@ void kernel_entry(uint32_t magic, uint32_t addr)
                    (( struct multiboot_tag_module * )tag)->mod_start,
                    (( struct multiboot_tag_module * )tag)->mod_end,
                    (( struct multiboot_tag_module * )tag)->cmdline);
+            boot_reserve((( struct multiboot_tag_module * )tag)->mod_start,
+                         (( struct multiboot_tag_module * )tag)->mod_end);
             break;
         case MULTIBOOT_TAG_TYPE_BASIC_MEMINFO:
             printf("[multiboot2] Tag memory info\n"
@@ -101,6 +195,7 @@ void kernel_entry(uint32_t magic, uint32_t addr)
             multiboot_memory_map_t *mmap;
 
             printf("[multiboot2] memory mapped devices\n");
+            mmap_tag = ( struct multiboot_tag_mmap * )tag;
 
             for (mmap = (( struct multiboot_tag_mmap * )tag)->entries;
                  ( multiboot_uint8_t * )mmap <
@@ -108,26 +203,21 @@ void kernel_entry(uint32_t magic, uint32_t addr)
                  mmap = ( multiboot_memory_map_t
                                   * )(( unsigned long )mmap +
                                       (( struct multiboot_tag_mmap * )tag)
-                                              ->entry_size))
-                printf("[multiboot2]     - base_addr = 0x%x\n"
-                       "                   length = 0x%x\n"
-                       "                   type = 0x%x\n",
-                       ( unsigned )(mmap->addr >> 32) |
-                               ( unsigned )(mmap->addr & 0xFFFFFFFF),
-                       ( unsigned )(mmap->len >> 32) |
-                               ( unsigned )(mmap->len & 0xFFFFFFFf),
-                       ( unsigned )mmap->type);
+                                              ->entry_size)) {
+                kprint("[multiboot2]     - base_addr = 0x", kp_hex(mmap->addr),
+                       "\n                   length = 0x", kp_hex(mmap->len),
+                       "\n                   type = 0x", kp_hex(mmap->type),
+                       "\n");
+            }
         } break;
         case MULTIBOOT_TAG_TYPE_FRAMEBUFFER: {
-            multiboot_uint32_t                color;
             unsigned                          i;
             struct multiboot_tag_framebuffer *tagfb =
                     ( struct multiboot_tag_framebuffer * )tag;
             void *fb =
                     ( void * )( unsigned long )tagfb->common.framebuffer_addr;
 
-            printf("[vbe] VESA VBE Framebuffer address: 0x%x\n",
-                   ( unsigned int )( uintptr_t )fb);
+            kprint("[vbe] VESA VBE Framebuffer address: ", fb, "\n");
 
             printf("[vbe] Framebuffer specification: width = %u\n"
                    "                                 height = %u\n"
@@ -136,72 +226,12 @@ void kernel_entry(uint32_t magic, uint32_t addr)
                    tagfb->common.framebuffer_height,
                    tagfb->common.framebuffer_bpp);
 
-            // int len = pfs_puts(tagfb, "Chat are we cooked?\n");
-            // printf("[vbe] Wrote %d characters to the framebuffer\n", len);
-
-            switch (tagfb->common.framebuffer_type) {
-            case MULTIBOOT_FRAMEBUFFER_TYPE_INDEXED: {
-                unsigned                best_distance, distance;
-                struct multiboot_color *palette;
-
-                palette       = tagfb->framebuffer_palette;
-
-                color         = 0;
-                best_distance = 4 * 256 * 256;
-
-                for (i = 0; i < tagfb->framebuffer_palette_num_colors; i++) {
-                    distance = (0xff - palette[i].blue) *
-                                       (0xff - palette[i].blue) +
-                               palette[i].red * palette[i].red +
-                               palette[i].green * palette[i].green;
-                    if (distance < best_distance) {
-                        color         = i;
-                        best_distance = distance;
-                    }
-                }
-            } break;
-
-            case MULTIBOOT_FRAMEBUFFER_TYPE_RGB:
-                color = ((1 << tagfb->framebuffer_blue_mask_size) - 1)
-                        << tagfb->framebuffer_blue_field_position;
-                break;
-
-            case MULTIBOOT_FRAMEBUFFER_TYPE_EGA_TEXT:
-                color = '\\' | 0x0100;
-                break;
-
-            default:
-                color = 0xffffffff;
-                break;
-            }
-
-            for (i = 0; i < tagfb->common.framebuffer_width &&
-                        i < tagfb->common.framebuffer_height;
-                 i++) {
-                switch (tagfb->common.framebuffer_bpp) {
-                case 8: {
-                    multiboot_uint8_t *pixel =
-                            fb + tagfb->common.framebuffer_pitch * i + i;
-                    *pixel = color;
-                } break;
-                case 15:
-                case 16: {
-                    multiboot_uint16_t *pixel =
-                            fb + tagfb->common.framebuffer_pitch * i + 2 * i;
-                    *pixel = color;
-                } break;
-                case 24: {
-                    multiboot_uint32_t *pixel =
-                            fb + tagfb->common.framebuffer_pitch * i + 3 * i;
-                    *pixel = (color & 0xffffff) | (*pixel & 0xff000000);
-                } break;
-
-                case 32: {
-                    multiboot_uint32_t *pixel =
-                            fb + tagfb->common.framebuffer_pitch * i + 4 * i;
-                    *pixel = color;
-                } break;
-                }
+            /* The test pattern, a blue diagonal from the top left */
+            fb_up = fb_init(tagfb) == 0;
+            if (fb_up) {
+                multiboot_uint32_t blue = fb_colour(&fb_screen, 0, 0, 0xFF);
+                for (i = 0; i < fb_screen.width && i < fb_screen.height; i++)
+                    fb_put(&fb_screen, i, i, blue);
             }
             break;
         }
@@ -211,8 +241,31 @@ void kernel_entry(uint32_t magic, uint32_t addr)
     tag = ( struct multiboot_tag * )(( multiboot_uint8_t * )tag +
                                      ((tag->size + 7) & ~7));
 
+    /* Modules can come after the memory map, so the back buffer is only
+     * placed once every tag has been seen */
+    if (fb_up && mmap_tag)
+        back_phys = back_buffer_place(
+                mmap_tag, ( uint64_t )fb_screen.pitch * fb_screen.height);
+    if (back_phys)
+        fb_set_back(&fb_screen,
+                    map_region(back_phys,
+                               ( size_t )fb_screen.pitch * fb_screen.height,
+                               CACHE_WB));
+    /* The log so far is replayed onto the framebuffer by the next drain */
+    if (fb_up && fbterm_init(&fb_screen, &psf_default) == 0)
+        printf("[vbe] Framebuffer terminal %ux%u\n",
+               fb_screen.width / psf_default.width,
+               fb_screen.height / psf_default.height);
+
+    cpu_print_features();
+    fb_bench(&fb_screen);
+
     printf("[multiboot2] Total mbi size 0x%x\n",
            ( int )(( uintptr_t )tag - addr));
+
+    /* Nothing left to do, let the consoles catch up with the log */
+    console_drain();
+    serial_drain();
 }
 
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
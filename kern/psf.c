@@ -28,691 +28,1032 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-// #include <stddef.h>
-// #include <stdint.h>
-//
-// #include <kernel/psf.h>
-// #include <string.h>
-//
-// uint8_t font[] = {
-//         0x36, 0x04, 0x03, 0x09, 0x7e, 0xc3, 0x99, 0xf3, 0xe7, 0xff, 0xe7,
-//         0x7e, 0x00, 0x00, 0x00, 0x7f, 0xe6, 0x66, 0x66, 0xc3, 0x00, 0x00,
-//         0x0c, 0x18, 0xfc, 0x30, 0xfc, 0x60, 0xc0, 0x00, 0x00, 0x18, 0x30,
-//         0x60, 0x30, 0x18, 0x00, 0x7c, 0x00, 0x00, 0x60, 0x30, 0x18, 0x30,
-//         0x60, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
-//         0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00,
-//         0x00, 0xc3, 0xc6, 0xcc, 0xd8, 0x36, 0x6e, 0xd6, 0xbf, 0x06, 0xc3,
-//         0xc6, 0xcc, 0xd8, 0x36, 0x6b, 0xc6, 0x8c, 0x0f, 0xe1, 0x33, 0x66,
-//         0x34, 0xea, 0x36, 0x6a, 0xdf, 0x82, 0x18, 0x18, 0x18, 0x18, 0x00,
-//         0x18, 0x18, 0x18, 0x18, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x78, 0x00,
-//         0x0e, 0x1b, 0x18, 0x3c, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x18, 0x18,
-//         0x7e, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18,
-//         0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0xcc, 0xd8, 0x30, 0x60, 0xdb,
-//         0x9b, 0x00, 0x00, 0xf1, 0x5b, 0x55, 0x51, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0x00, 0x00, 0x00,
-//         0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18,
-//         0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x66, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xcc, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x66, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x00, 0xc6, 0x7c, 0x7e, 0xc0,
-//         0xce, 0xc6, 0x7e, 0x00, 0x00, 0xc6, 0x7c, 0x00, 0x76, 0xcc, 0x7c,
-//         0x0c, 0xf8, 0x00, 0x30, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00,
-//         0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x78,
-//         0xc4, 0x70, 0x38, 0x8c, 0x78, 0x0c, 0x78, 0x00, 0x00, 0x7c, 0xc0,
-//         0x78, 0x0c, 0xf8, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x78, 0x30, 0x30, 0x00, 0x30,
-//         0x00, 0x00, 0x6c, 0x6c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x10, 0x7c,
-//         0xd0, 0x7c, 0x16, 0x7c, 0x10, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0x18,
-//         0x30, 0x66, 0xc6, 0x00, 0x00, 0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc,
-//         0x76, 0x00, 0x00, 0x18, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00, 0x00, 0x60,
-//         0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x6c, 0x38,
-//         0xfe, 0x38, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xfc, 0x30,
-//         0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
-//         0x30, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x06, 0x0c,
-//         0x18, 0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xd6,
-//         0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x30, 0x70, 0x30, 0x30, 0x30, 0x30,
-//         0xfc, 0x00, 0x00, 0x78, 0xcc, 0x0c, 0x38, 0x60, 0xcc, 0xfc, 0x00,
-//         0x00, 0x78, 0xcc, 0x0c, 0x38, 0x0c, 0xcc, 0x78, 0x00, 0x00, 0x1c,
-//         0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x1e, 0x00, 0x00, 0xfc, 0xc0, 0xf8,
-//         0x0c, 0x0c, 0xcc, 0x78, 0x00, 0x00, 0x38, 0x60, 0xc0, 0xf8, 0xcc,
-//         0xcc, 0x78, 0x00, 0x00, 0xfc, 0xcc, 0x0c, 0x18, 0x30, 0x30, 0x30,
-//         0x00, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00, 0x00,
-//         0x78, 0xcc, 0xcc, 0x7c, 0x0c, 0x18, 0x70, 0x00, 0x00, 0x00, 0x30,
-//         0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,
-//         0x00, 0x30, 0x30, 0x60, 0x00, 0x18, 0x30, 0x60, 0xc0, 0x60, 0x30,
-//         0x18, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00,
-//         0x00, 0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00, 0x00, 0x78,
-//         0xcc, 0x0c, 0x18, 0x30, 0x00, 0x30, 0x00, 0x00, 0x7c, 0xc6, 0xde,
-//         0xde, 0xdc, 0xc0, 0x78, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
-//         0xc6, 0xc6, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc,
-//         0x00, 0x00, 0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x00, 0x00,
-//         0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0xfe, 0x62,
-//         0x68, 0x78, 0x68, 0x62, 0xfe, 0x00, 0x00, 0xfe, 0x62, 0x68, 0x78,
-//         0x68, 0x60, 0xf0, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xc0, 0xce, 0x66,
-//         0x3e, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00,
-//         0x00, 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x1e,
-//         0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0xe6, 0x66, 0x6c,
-//         0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x62,
-//         0x66, 0xfe, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6,
-//         0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00, 0x00,
-//         0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0xfc, 0x66,
-//         0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
-//         0xc6, 0xce, 0x7c, 0x0e, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x6c, 0x66,
-//         0xe6, 0x00, 0x00, 0x78, 0xcc, 0xe0, 0x78, 0x1c, 0xcc, 0x78, 0x00,
-//         0x00, 0xfc, 0xb4, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0xc6,
-//         0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
-//         0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6,
-//         0xfe, 0x6c, 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6,
-//         0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x78, 0x30, 0x30, 0x78, 0x00, 0x00,
-//         0xfe, 0xcc, 0x98, 0x30, 0x62, 0xc6, 0xfe, 0x00, 0x00, 0x78, 0x60,
-//         0x60, 0x60, 0x60, 0x60, 0x78, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x18,
-//         0x0c, 0x06, 0x02, 0x00, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18,
-//         0x78, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x30,
-//         0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-//         0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x7c, 0x66,
-//         0x66, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78,
-//         0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00,
-//         0x00, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x38, 0x6c,
-//         0x60, 0xf0, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc,
-//         0xcc, 0x7c, 0x0c, 0xf8, 0x00, 0xe0, 0x60, 0x6c, 0x76, 0x66, 0x66,
-//         0xe6, 0x00, 0x00, 0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,
-//         0x00, 0x0c, 0x00, 0x1c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00, 0xe0,
-//         0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x00, 0x00, 0x70, 0x30, 0x30,
-//         0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6,
-//         0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66,
-//         0x00, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00,
-//         0x00, 0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x00,
-//         0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0xdc, 0x76,
-//         0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc0, 0x78, 0x0c,
-//         0xf8, 0x00, 0x00, 0x10, 0x30, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00,
-//         0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
-//         0x00, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0xc6,
-//         0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38,
-//         0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c,
-//         0xf8, 0x00, 0x00, 0x00, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00,
-//         0x1c, 0x30, 0x30, 0xe0, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x18, 0x18,
-//         0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xe0, 0x30, 0x30, 0x1c,
-//         0x30, 0x30, 0xe0, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00,
-//         0x00, 0xc0, 0x60, 0x1c, 0x36, 0x63, 0x7f, 0x63, 0x00, 0x00, 0x03,
-//         0x06, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0x10, 0x28, 0x00,
-//         0x7c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6,
-//         0xfe, 0xc6, 0x00, 0x00, 0x6c, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6,
-//         0x00, 0x00, 0x38, 0x6c, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00, 0x00,
-//         0x3f, 0x6d, 0xcc, 0xff, 0xcc, 0xcd, 0xcf, 0x00, 0x00, 0x3c, 0x66,
-//         0xc0, 0xc0, 0x66, 0x3c, 0x06, 0x3c, 0x00, 0x60, 0x30, 0xfe, 0x62,
-//         0x78, 0x62, 0xfe, 0x00, 0x00, 0x0c, 0x18, 0xfe, 0x62, 0x78, 0x62,
-//         0xfe, 0x00, 0x00, 0x10, 0x28, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00,
-//         0x00, 0x6c, 0x00, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x60,
-//         0x30, 0x00, 0x78, 0x30, 0x30, 0x78, 0x00, 0x00, 0x18, 0x30, 0x00,
-//         0x78, 0x30, 0x30, 0x78, 0x00, 0x00, 0x20, 0x50, 0x00, 0x78, 0x30,
-//         0x30, 0x78, 0x00, 0x00, 0xcc, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78,
-//         0x00, 0x00, 0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00, 0x00,
-//         0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00, 0x00, 0x60, 0x30,
-//         0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x7c,
-//         0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x10, 0x28, 0x00, 0x7c, 0xc6, 0xc6,
-//         0x7c, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00,
-//         0x00, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
-//         0x00, 0x6c, 0x38, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x67, 0x6e,
-//         0x7e, 0x76, 0xe6, 0xbc, 0x00, 0x00, 0x60, 0x30, 0x00, 0xc6, 0xc6,
-//         0xc6, 0x7c, 0x00, 0x00, 0x0c, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0x7c,
-//         0x00, 0x00, 0x10, 0x28, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00,
-//         0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x18, 0x30,
-//         0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66,
-//         0x7c, 0x60, 0xf0, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6,
-//         0xcc, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-//         0xaa, 0x30, 0x00, 0x30, 0x30, 0x78, 0x78, 0x30, 0x00, 0x00, 0x00,
-//         0x10, 0x7c, 0xd6, 0xd0, 0xd6, 0x7c, 0x10, 0x00, 0x38, 0x6c, 0x64,
-//         0xf0, 0x60, 0x66, 0xfc, 0x00, 0x00, 0x1e, 0x31, 0xfc, 0x60, 0xf8,
-//         0x33, 0x1e, 0x00, 0x00, 0xcc, 0xcc, 0x78, 0xfc, 0x30, 0xfc, 0x30,
-//         0x00, 0x00, 0x28, 0x10, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00,
-//         0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c, 0x00, 0x28, 0x10,
-//         0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00, 0x3c, 0x42, 0x99, 0xa1,
-//         0xa1, 0x99, 0x42, 0x3c, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e,
-//         0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0xfc, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
-//         0x66, 0x3c, 0x66, 0x66, 0x3c, 0x66, 0x00, 0x00, 0x3c, 0x42, 0xb9,
-//         0xa5, 0xb9, 0xa5, 0x42, 0x3c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0xfc, 0x00, 0x00,
-//         0x38, 0x6c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c,
-//         0x38, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0xfc, 0x98,
-//         0x30, 0x64, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
-//         0x7b, 0xc0, 0x00, 0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x50,
-//         0x20, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00, 0x18, 0x38, 0x18,
-//         0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00,
-//         0x7c, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00,
-//         0x00, 0x00, 0x7f, 0xcd, 0xcc, 0xcf, 0xcc, 0xcd, 0x7f, 0x00, 0x00,
-//         0x00, 0x00, 0x7e, 0xdb, 0xde, 0xd8, 0x7e, 0x00, 0x00, 0xcc, 0x00,
-//         0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00, 0x30, 0x00, 0x30, 0x60,
-//         0xc0, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
-//         0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-//         0x18, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x00,
-//         0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-//         0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0xf8,
-//         0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18,
-//         0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18,
-//         0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-//         0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
-//         0xff, 0x18, 0x18, 0x18, 0x18, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
-//         0x88, 0x22, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
-//         0xff, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
-//         0x36, 0x36, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36,
-//         0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36,
-//         0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0xf6,
-//         0x06, 0xfe, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37,
-//         0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36,
-//         0x36, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36,
-//         0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36,
-//         0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff,
-//         0xff, 0xff, 0xff, 0xff, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
-//         0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00,
-//         0x00, 0x18, 0x30, 0x7f, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
-//         0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x60, 0x30, 0x78, 0x0c,
-//         0x7c, 0xcc, 0x76, 0x00, 0x00, 0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc,
-//         0x76, 0x00, 0x00, 0x10, 0x28, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00,
-//         0x00, 0x76, 0xdc, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0x6c,
-//         0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0x38, 0x6c, 0x38,
-//         0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1b, 0x7e,
-//         0xd8, 0x6e, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x0c,
-//         0x78, 0x00, 0x60, 0x30, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00,
-//         0x18, 0x30, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x10, 0x28,
-//         0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x6c, 0x00, 0x78, 0xcc,
-//         0xfc, 0xc0, 0x78, 0x00, 0x00, 0x60, 0x30, 0x00, 0x70, 0x30, 0x30,
-//         0x78, 0x00, 0x00, 0x18, 0x30, 0x00, 0x70, 0x30, 0x30, 0x78, 0x00,
-//         0x00, 0x20, 0x50, 0x00, 0x70, 0x30, 0x30, 0x78, 0x00, 0x00, 0xd8,
-//         0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x34, 0x18, 0x2c,
-//         0x7c, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66,
-//         0x66, 0x66, 0x00, 0x00, 0x60, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0x7c,
-//         0x00, 0x00, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00,
-//         0x10, 0x28, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x76, 0xdc,
-//         0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x7c,
-//         0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x30, 0x30, 0x00, 0xfc, 0x00, 0x30,
-//         0x30, 0x00, 0x00, 0x00, 0x3d, 0x66, 0x6e, 0x76, 0x66, 0xbc, 0x00,
-//         0x00, 0x60, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x18,
-//         0x30, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x20, 0x50, 0x00,
-//         0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc,
-//         0xcc, 0x76, 0x00, 0x00, 0x18, 0x30, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c,
-//         0xf8, 0x00, 0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00,
-//         0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8, 0x00, 0x0c, 0x18,
-//         0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x18, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x00, 0x33, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x9b, 0xdb, 0xf8, 0xdb, 0xd8, 0xd8, 0x00, 0x00, 0x7c, 0x06, 0xff,
-//         0x18, 0xff, 0x60, 0x3e, 0x00, 0x00, 0xfc, 0x66, 0xfc, 0x60, 0xfe,
-//         0x60, 0xf0, 0x00, 0x00, 0xfc, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xfc,
-//         0x00, 0x00, 0xfe, 0xc6, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-//         0x3c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6, 0x00, 0xd6, 0xd6,
-//         0x7c, 0x38, 0x7c, 0xd6, 0xd6, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x7c,
-//         0x06, 0xc6, 0x7c, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6,
-//         0xc6, 0x00, 0x00, 0xda, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00,
-//         0x00, 0x3e, 0x76, 0x66, 0x66, 0x66, 0xe6, 0xc6, 0x00, 0x00, 0xfe,
-//         0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
-//         0x7e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x10, 0x7c, 0xd6, 0xd6, 0xd6,
-//         0xd6, 0x7c, 0x10, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe,
-//         0x06, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, 0x00,
-//         0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0xd6, 0xd6,
-//         0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03, 0x00, 0xf0, 0xb0, 0x30, 0x3c,
-//         0x36, 0x36, 0x3c, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0xf2, 0xda, 0xda,
-//         0xf2, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xf8, 0xcc, 0xcc, 0xf8, 0x00,
-//         0x00, 0x7c, 0xc6, 0x06, 0x7e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x9c,
-//         0xb6, 0xb6, 0xf6, 0xb6, 0xb6, 0x9c, 0x00, 0x00, 0x7e, 0xcc, 0xcc,
-//         0x7c, 0x6c, 0xcc, 0xce, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xfc, 0xc0,
-//         0xc6, 0x7c, 0x00, 0x00, 0xda, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c,
-//         0x00, 0x00, 0xfc, 0x30, 0x30, 0x3c, 0x36, 0x36, 0x26, 0x0c, 0x00,
-//         0x0c, 0x18, 0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x3c, 0x6c,
-//         0x6c, 0x6e, 0x6a, 0xea, 0xce, 0x00, 0x00, 0xd8, 0xd8, 0xd8, 0xfe,
-//         0xda, 0xda, 0xde, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x3c, 0x36, 0x36,
-//         0x36, 0x00, 0x00, 0xda, 0xd6, 0xcc, 0xf8, 0xcc, 0xc6, 0xc6, 0x00,
-//         0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10, 0x00, 0x06,
-//         0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xb6, 0xd6, 0xce,
-//         0xde, 0xf6, 0xe6, 0xc6, 0x00, 0x00, 0x0c, 0x38, 0xe0, 0xf8, 0xcc,
-//         0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcc, 0xf8, 0xcc, 0xf8,
-//         0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
-//         0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6, 0x00, 0x00, 0x00,
-//         0xd6, 0x54, 0x38, 0x54, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6,
-//         0x1c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6,
-//         0xe6, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00,
-//         0x00, 0x00, 0x00, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0x00, 0x00, 0x00,
-//         0x00, 0x3e, 0x76, 0x66, 0xe6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xc6,
-//         0xee, 0xfe, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xfc,
-//         0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc,
-//         0x00, 0x00, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
-//         0x00, 0x10, 0x7c, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00,
-//         0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06, 0x00, 0x00, 0x00, 0xcc, 0xcc,
-//         0x7c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6,
-//         0xfe, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03,
-//         0x00, 0x00, 0x00, 0xf0, 0x30, 0x3c, 0x36, 0x3c, 0x00, 0x00, 0x00,
-//         0x00, 0xc2, 0xc2, 0xf2, 0xda, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xc0,
-//         0xc0, 0xf8, 0xcc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x1e,
-//         0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb6, 0xf6, 0xb6, 0x9c,
-//         0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0x7e, 0x36, 0xe6, 0x00, 0x00,
-//         0x00, 0x00, 0x7c, 0xc6, 0xf0, 0xc6, 0x7c, 0x00, 0x00, 0x6c, 0x38,
-//         0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x7c, 0x00, 0x60, 0xfc, 0x60, 0x7c,
-//         0x66, 0x66, 0x46, 0x0c, 0x00, 0x0c, 0x18, 0xfe, 0xc0, 0xc0, 0xc0,
-//         0xc0, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6e, 0xea, 0xce, 0x00,
-//         0x00, 0x00, 0x00, 0xd8, 0xd8, 0xfe, 0xda, 0xde, 0x00, 0x00, 0x60,
-//         0xfc, 0x60, 0x7c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x0c, 0x18, 0xc6,
-//         0xcc, 0xf8, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
-//         0xc6, 0xfe, 0x10, 0x00, 0x04, 0x0c, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0,
-//         0x00, 0x00, 0x60, 0x30, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0x00, 0x10, 0x10,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x54, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xbc, 0x66, 0x66, 0x7e, 0x66,
-//         0x66, 0x00, 0x00, 0xbe, 0xb2, 0x30, 0x3c, 0x30, 0x32, 0x3e, 0x00,
-//         0x00, 0xb6, 0xb6, 0x36, 0x3e, 0x36, 0x36, 0x36, 0x00, 0x00, 0xbc,
-//         0x98, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x9c, 0xb6, 0x36,
-//         0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0xb3, 0xb3, 0x33, 0x1e, 0x0c,
-//         0x0c, 0x1e, 0x00, 0x00, 0x9c, 0xb6, 0x36, 0x36, 0x36, 0x14, 0x77,
-//         0x00, 0x00, 0x10, 0x54, 0x00, 0x70, 0x30, 0x30, 0x18, 0x00, 0x00,
-//         0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xfe, 0x00, 0x00, 0x7c, 0xc6,
-//         0xc6, 0xfe, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x10, 0x38, 0x38, 0x6c,
-//         0x6c, 0xc6, 0xc6, 0x00, 0x00, 0xfe, 0xc6, 0x00, 0x7c, 0x00, 0xc6,
-//         0xfe, 0x00, 0x00, 0xfc, 0xc4, 0x60, 0x30, 0x60, 0xc4, 0xfc, 0x00,
-//         0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x7c,
-//         0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x10, 0x10, 0x76,
-//         0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x08, 0x08, 0x3c, 0x60, 0x38,
-//         0x60, 0x3c, 0x00, 0x00, 0x10, 0x10, 0xb8, 0xcc, 0xcc, 0xcc, 0xcc,
-//         0x0c, 0x00, 0x10, 0x10, 0x70, 0x30, 0x30, 0x30, 0x18, 0x00, 0x00,
-//         0x10, 0x54, 0x00, 0xe6, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00,
-//         0x76, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x7c, 0xc6, 0xcc, 0xdc,
-//         0xc6, 0xc6, 0xdc, 0xc0, 0x00, 0x00, 0x00, 0xe6, 0x36, 0x1c, 0x36,
-//         0x36, 0x1c, 0x00, 0x1e, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0x7c, 0x00,
-//         0x00, 0x00, 0x00, 0x3c, 0x60, 0x38, 0x60, 0x3c, 0x00, 0x00, 0xfe,
-//         0x18, 0x30, 0x30, 0x1c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0xb8,
-//         0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6,
-//         0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x18,
-//         0x00, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xcc, 0xc6, 0x00, 0x00,
-//         0x70, 0x18, 0x0c, 0x1c, 0x36, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
-//         0xc6, 0xc6, 0xcc, 0xd8, 0xf0, 0x00, 0x00, 0x7e, 0x18, 0x30, 0x1c,
-//         0x30, 0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xf8,
-//         0xc0, 0xc0, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xc0, 0x78, 0x0c, 0x38,
-//         0x00, 0x00, 0x00, 0x7e, 0xd8, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00,
-//         0x00, 0xfe, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xe6,
-//         0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd6, 0xd6,
-//         0xd6, 0x7c, 0x10, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6,
-//         0xc6, 0x00, 0x00, 0x00, 0xc6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x00,
-//         0x00, 0x00, 0x6c, 0xc6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x48, 0x00,
-//         0x70, 0x30, 0x30, 0x30, 0x18, 0x00, 0x00, 0x24, 0x00, 0xe6, 0x66,
-//         0x66, 0x66, 0x3c, 0x00, 0x00, 0x20, 0x20, 0x78, 0xcc, 0xcc, 0xcc,
-//         0x78, 0x00, 0x00, 0x10, 0x10, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00,
-//         0x00, 0x10, 0x10, 0x44, 0xc6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x7c,
-//         0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0xc6, 0x7c, 0x00,
-//         0x7c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6,
-//         0xce, 0x0c, 0x07, 0x00, 0x18, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc,
-//         0x00, 0x00, 0x0c, 0x18, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00, 0x00,
-//         0x08, 0x14, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00, 0x00, 0x18, 0x00,
-//         0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00, 0x00, 0x28, 0x10, 0x3c, 0x66,
-//         0x60, 0x66, 0x3c, 0x00, 0x00, 0x18, 0x00, 0xf8, 0x6c, 0x66, 0x6c,
-//         0xf8, 0x00, 0x00, 0x28, 0x10, 0xf8, 0x6c, 0x66, 0x6c, 0xf8, 0x00,
-//         0x00, 0x7c, 0x00, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x18,
-//         0x00, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x28, 0x10, 0xfe,
-//         0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x78, 0x62,
-//         0xfe, 0x30, 0x1e, 0x00, 0x18, 0x00, 0xfe, 0x62, 0x78, 0x60, 0xf0,
-//         0x00, 0x00, 0x10, 0x28, 0x7e, 0xc0, 0xce, 0xc6, 0x7e, 0x00, 0x00,
-//         0x18, 0x00, 0x7e, 0xc0, 0xce, 0xc6, 0x7e, 0x00, 0x00, 0x3c, 0x66,
-//         0xc0, 0xce, 0x66, 0x3e, 0x0c, 0x78, 0x00, 0x10, 0x28, 0xc6, 0xc6,
-//         0xfe, 0xc6, 0xc6, 0x00, 0x00, 0x66, 0xff, 0x66, 0x7e, 0x66, 0x66,
-//         0x66, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x3c, 0x18, 0x18, 0x3c, 0x00,
-//         0x00, 0xf8, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x78,
-//         0x30, 0x30, 0x30, 0x30, 0x78, 0x30, 0x1e, 0x00, 0x4f, 0xa6, 0x06,
-//         0x06, 0x66, 0x66, 0x3c, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0x66,
-//         0xe6, 0x30, 0xe0, 0x00, 0xf3, 0x66, 0x60, 0x60, 0x62, 0x66, 0xfe,
-//         0x00, 0x00, 0xf5, 0x62, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00,
-//         0xf0, 0x60, 0x60, 0x60, 0x66, 0xfe, 0x0c, 0x78, 0x00, 0xe0, 0x60,
-//         0x78, 0xe0, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x18, 0xc6, 0xee, 0xfe,
-//         0xfe, 0xd6, 0xc6, 0x00, 0x00, 0x0c, 0x18, 0xe6, 0xf6, 0xde, 0xce,
-//         0xc6, 0x00, 0x00, 0x28, 0x10, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00,
-//         0x00, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xe6, 0x30, 0xe0, 0x00, 0xc6,
-//         0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x06, 0x1c, 0x00, 0x7c, 0x00, 0x7c,
-//         0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x33, 0x66, 0x00, 0x7c, 0xc6,
-//         0xc6, 0x7c, 0x00, 0x00, 0x18, 0x00, 0xfc, 0x66, 0x7c, 0x60, 0xf0,
-//         0x00, 0x00, 0x0c, 0x18, 0xfc, 0x66, 0x7c, 0x6c, 0xe6, 0x00, 0x00,
-//         0x28, 0x10, 0xfc, 0x66, 0x7c, 0x6c, 0xe6, 0x00, 0x00, 0xfc, 0x66,
-//         0x66, 0x7c, 0x6c, 0xe6, 0x30, 0xe0, 0x00, 0x0c, 0x18, 0x7c, 0xc0,
-//         0x78, 0x0c, 0xf8, 0x00, 0x00, 0x10, 0x28, 0x7c, 0xc0, 0x78, 0x0c,
-//         0xf8, 0x00, 0x00, 0x18, 0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00,
-//         0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x30, 0x60, 0x00, 0x30,
-//         0x00, 0xfc, 0xb4, 0x30, 0x30, 0x78, 0x00, 0x00, 0x50, 0x20, 0xfc,
-//         0xb4, 0x30, 0x30, 0x78, 0x00, 0x00, 0xfc, 0xb4, 0x30, 0x30, 0x78,
-//         0x00, 0x30, 0x60, 0x00, 0xfc, 0xb4, 0x30, 0x30, 0x30, 0x78, 0x0c,
-//         0x78, 0x00, 0xfc, 0xb4, 0x30, 0x78, 0x30, 0x30, 0x78, 0x00, 0x00,
-//         0x76, 0xdc, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x7c, 0x00,
-//         0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0xc6, 0x7c, 0x00, 0xc6,
-//         0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x38, 0x6c, 0x38, 0xc6, 0xc6, 0xc6,
-//         0x7c, 0x00, 0x00, 0x33, 0x66, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
-//         0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x30, 0x1e, 0x00, 0x60,
-//         0x30, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x0c, 0x18, 0xc6,
-//         0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x10, 0x28, 0xc6, 0xd6, 0xd6,
-//         0xfe, 0x6c, 0x00, 0x00, 0x6c, 0x00, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c,
-//         0x00, 0x00, 0x60, 0x30, 0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00,
-//         0x10, 0x28, 0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00, 0x18, 0x30,
-//         0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00, 0x30, 0x00, 0xfc, 0x98,
-//         0x30, 0x64, 0xfc, 0x00, 0x00, 0x7c, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
-//         0x76, 0x00, 0x00, 0xc6, 0x7c, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00,
-//         0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x0c, 0x07, 0x00, 0xec,
-//         0x60, 0x60, 0x7c, 0x66, 0x66, 0xdc, 0x00, 0x00, 0x18, 0x30, 0x78,
-//         0xcc, 0xc0, 0xcc, 0x78, 0x00, 0x00, 0x10, 0x28, 0x78, 0xcc, 0xc0,
-//         0xcc, 0x78, 0x00, 0x00, 0x30, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78,
-//         0x00, 0x00, 0x50, 0x20, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x00, 0x00,
-//         0x6c, 0x0c, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0xac, 0x4c,
-//         0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x0c, 0x7e, 0x0c, 0x7c,
-//         0xcc, 0xcc, 0x76, 0x00, 0x00, 0x78, 0x00, 0x78, 0xcc, 0xfc, 0xc0,
-//         0x78, 0x00, 0x00, 0x30, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00,
-//         0x00, 0x50, 0x20, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x78,
-//         0xcc, 0xfc, 0xc0, 0x7c, 0x60, 0x3c, 0x00, 0x00, 0x33, 0x68, 0x60,
-//         0xf0, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x10, 0x28, 0x76, 0xcc, 0xcc,
-//         0x7c, 0x0c, 0xf8, 0x00, 0x18, 0x00, 0x76, 0xcc, 0xcc, 0x7c, 0x0c,
-//         0xf8, 0x00, 0x1c, 0x30, 0x00, 0x76, 0xcc, 0x7c, 0x0c, 0xf8, 0x00,
-//         0xe4, 0x6a, 0x60, 0x6c, 0x76, 0x66, 0xe6, 0x00, 0x00, 0x76, 0xdc,
-//         0x00, 0x70, 0x30, 0x30, 0x78, 0x00, 0x00, 0xf8, 0x00, 0x70, 0x30,
-//         0x30, 0x30, 0x78, 0x00, 0x00, 0x30, 0x00, 0x70, 0x30, 0x30, 0x78,
-//         0x60, 0x3c, 0x00, 0x08, 0x14, 0x00, 0x1c, 0x0c, 0xcc, 0xcc, 0x78,
-//         0x00, 0xe0, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x30, 0xe0, 0x00, 0xe6,
-//         0x6c, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x75, 0x32, 0x30,
-//         0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30,
-//         0x78, 0x18, 0xf0, 0x00, 0x70, 0x30, 0x30, 0x3c, 0xf0, 0x30, 0x78,
-//         0x00, 0x00, 0x30, 0x00, 0xec, 0xfe, 0xd6, 0xd6, 0xd6, 0x00, 0x00,
-//         0x0c, 0x18, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00, 0x00, 0x28, 0x10,
-//         0xdc, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
-//         0x66, 0x66, 0x30, 0xe0, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66,
-//         0x46, 0x1c, 0x00, 0x78, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00,
-//         0x00, 0x33, 0x66, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x18,
-//         0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x0c, 0x18, 0x00,
-//         0xdc, 0x76, 0x60, 0xf0, 0x00, 0x00, 0x28, 0x10, 0xdc, 0x76, 0x60,
-//         0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x60, 0xf0, 0x30,
-//         0xe0, 0x00, 0x0c, 0x18, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00,
-//         0x10, 0x28, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00, 0x30, 0x00,
-//         0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x7c, 0xc0, 0x78,
-//         0x0c, 0xf8, 0x10, 0x30, 0x00, 0x16, 0x30, 0xfc, 0x30, 0x30, 0x36,
-//         0x1c, 0x00, 0x00, 0x15, 0x32, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00,
-//         0x00, 0x10, 0x30, 0xfc, 0x30, 0x36, 0x1c, 0x10, 0x30, 0x00, 0x10,
-//         0x30, 0xfc, 0x30, 0x36, 0x1c, 0x0c, 0x78, 0x00, 0x10, 0x30, 0xfc,
-//         0x30, 0xfc, 0x30, 0x1c, 0x00, 0x00, 0x76, 0xdc, 0x00, 0xcc, 0xcc,
-//         0xcc, 0x76, 0x00, 0x00, 0x78, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76,
-//         0x00, 0x00, 0xc6, 0x7c, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00,
-//         0x38, 0x6c, 0x38, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x33, 0x66,
-//         0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc,
-//         0xcc, 0x76, 0x0c, 0x07, 0x00, 0x60, 0x30, 0xc6, 0xd6, 0xd6, 0xfe,
-//         0x6c, 0x00, 0x00, 0x0c, 0x18, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00,
-//         0x00, 0x10, 0x28, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x6c,
-//         0x00, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x60, 0x30, 0xcc,
-//         0xcc, 0xcc, 0x7c, 0x0c, 0xf8, 0x00, 0x20, 0x50, 0x00, 0xcc, 0xcc,
-//         0x7c, 0x0c, 0xf8, 0x00, 0x18, 0x30, 0xfc, 0x98, 0x30, 0x64, 0xfc,
-//         0x00, 0x00, 0x30, 0x00, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00,
-//         0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00,
-//         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-//         0x30, 0x1e, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-//         0x60, 0x22, 0xff, 0xff, 0x64, 0x22, 0xff, 0xff, 0x65, 0x22, 0xff,
-//         0xff, 0xa0, 0x25, 0xac, 0x25, 0xae, 0x25, 0xfc, 0x25, 0xfe, 0x25,
-//         0x1b, 0x2b, 0x0e, 0x22, 0xff, 0xff, 0xc6, 0x25, 0x66, 0x26, 0x25,
-//         0x2b, 0x27, 0x2b, 0xff, 0xff, 0xbc, 0x00, 0xff, 0xff, 0xbd, 0x00,
-//         0xff, 0xff, 0xbe, 0x00, 0xff, 0xff, 0xa6, 0x00, 0xff, 0xff, 0xa8,
-//         0x00, 0xff, 0xff, 0xb8, 0x00, 0xff, 0xff, 0x92, 0x01, 0xff, 0xff,
-//         0x20, 0x20, 0xff, 0xff, 0x21, 0x20, 0xff, 0xff, 0x30, 0x20, 0xff,
-//         0xff, 0x22, 0x21, 0xff, 0xff, 0x26, 0x20, 0xff, 0xff, 0x39, 0x20,
-//         0xff, 0xff, 0x3a, 0x20, 0xff, 0xff, 0x1c, 0x20, 0x1f, 0x20, 0xff,
-//         0xff, 0x1d, 0x20, 0xee, 0x02, 0xff, 0xff, 0x1e, 0x20, 0xff, 0xff,
-//         0x42, 0x2e, 0xff, 0xff, 0x41, 0x2e, 0xce, 0x02, 0xff, 0xff, 0x1e,
-//         0x01, 0xff, 0xff, 0x1f, 0x01, 0xff, 0xff, 0x30, 0x01, 0xff, 0xff,
-//         0x31, 0x01, 0xff, 0xff, 0x5e, 0x01, 0xff, 0xff, 0x5f, 0x01, 0xff,
-//         0xff, 0x20, 0x00, 0xa0, 0x00, 0x00, 0x20, 0x01, 0x20, 0x02, 0x20,
-//         0x03, 0x20, 0x04, 0x20, 0x05, 0x20, 0x06, 0x20, 0x07, 0x20, 0x08,
-//         0x20, 0x09, 0x20, 0x0a, 0x20, 0x2f, 0x20, 0x5f, 0x20, 0xff, 0xff,
-//         0x21, 0x00, 0xff, 0xff, 0x22, 0x00, 0xff, 0xff, 0x23, 0x00, 0xff,
-//         0xff, 0x24, 0x00, 0xff, 0xff, 0x25, 0x00, 0xff, 0xff, 0x26, 0x00,
-//         0xff, 0xff, 0x27, 0x00, 0xbc, 0x02, 0xff, 0xff, 0x28, 0x00, 0xff,
-//         0xff, 0x29, 0x00, 0xff, 0xff, 0x2a, 0x00, 0x4e, 0x20, 0x17, 0x22,
-//         0xff, 0xff, 0x2b, 0x00, 0xff, 0xff, 0x2c, 0x00, 0xcf, 0x02, 0x75,
-//         0x03, 0x1a, 0x20, 0xff, 0xff, 0x2d, 0x00, 0xad, 0x00, 0x10, 0x20,
-//         0x11, 0x20, 0x12, 0x20, 0x13, 0x20, 0x43, 0x20, 0x12, 0x22, 0xff,
-//         0xff, 0x2e, 0x00, 0x24, 0x20, 0xff, 0xff, 0x2f, 0x00, 0x44, 0x20,
-//         0x15, 0x22, 0xff, 0xff, 0x30, 0x00, 0xff, 0xff, 0x31, 0x00, 0xff,
-//         0xff, 0x32, 0x00, 0xff, 0xff, 0x33, 0x00, 0xff, 0xff, 0x34, 0x00,
-//         0xff, 0xff, 0x35, 0x00, 0xff, 0xff, 0x36, 0x00, 0xff, 0xff, 0x37,
-//         0x00, 0xff, 0xff, 0x38, 0x00, 0xff, 0xff, 0x39, 0x00, 0xff, 0xff,
-//         0x3a, 0x00, 0x36, 0x22, 0xff, 0xff, 0x3b, 0x00, 0xff, 0xff, 0x3c,
-//         0x00, 0xff, 0xff, 0x3d, 0x00, 0x40, 0x2e, 0xff, 0xff, 0x3e, 0x00,
-//         0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x40, 0x00, 0xff, 0xff, 0x41,
-//         0x00, 0x10, 0x04, 0x91, 0x03, 0xff, 0xff, 0x42, 0x00, 0x12, 0x04,
-//         0x92, 0x03, 0xff, 0xff, 0x43, 0x00, 0x21, 0x04, 0xf9, 0x03, 0xff,
-//         0xff, 0x44, 0x00, 0xff, 0xff, 0x45, 0x00, 0x15, 0x04, 0x95, 0x03,
-//         0xff, 0xff, 0x46, 0x00, 0xff, 0xff, 0x47, 0x00, 0xff, 0xff, 0x48,
-//         0x00, 0x1d, 0x04, 0x97, 0x03, 0xff, 0xff, 0x49, 0x00, 0x06, 0x04,
-//         0xc0, 0x04, 0xcf, 0x04, 0x99, 0x03, 0xff, 0xff, 0x4a, 0x00, 0x08,
-//         0x04, 0x7f, 0x03, 0xff, 0xff, 0x4b, 0x00, 0x1a, 0x04, 0x9a, 0x03,
-//         0x2a, 0x21, 0xff, 0xff, 0x4c, 0x00, 0xff, 0xff, 0x4d, 0x00, 0x1c,
-//         0x04, 0x9c, 0x03, 0xfa, 0x03, 0xff, 0xff, 0x4e, 0x00, 0x9d, 0x03,
-//         0xff, 0xff, 0x4f, 0x00, 0x1e, 0x04, 0x9f, 0x03, 0xff, 0xff, 0x50,
-//         0x00, 0x20, 0x04, 0xa1, 0x03, 0xff, 0xff, 0x51, 0x00, 0x1a, 0x05,
-//         0xff, 0xff, 0x52, 0x00, 0xff, 0xff, 0x53, 0x00, 0x05, 0x04, 0xff,
-//         0xff, 0x54, 0x00, 0x22, 0x04, 0xa4, 0x03, 0xff, 0xff, 0x55, 0x00,
-//         0xff, 0xff, 0x56, 0x00, 0xff, 0xff, 0x57, 0x00, 0x1c, 0x05, 0xff,
-//         0xff, 0x58, 0x00, 0x25, 0x04, 0xa7, 0x03, 0xff, 0xff, 0x59, 0x00,
-//         0xae, 0x04, 0xa5, 0x03, 0xff, 0xff, 0x5a, 0x00, 0x96, 0x03, 0xff,
-//         0xff, 0x5b, 0x00, 0xff, 0xff, 0x5c, 0x00, 0xf5, 0x29, 0xff, 0xff,
-//         0x5d, 0x00, 0xff, 0xff, 0x5e, 0x00, 0xc4, 0x02, 0xc6, 0x02, 0x03,
-//         0x23, 0xff, 0xff, 0x5f, 0x00, 0xff, 0xff, 0x60, 0x00, 0xcb, 0x02,
-//         0xef, 0x1f, 0x35, 0x20, 0xff, 0xff, 0x61, 0x00, 0x30, 0x04, 0xff,
-//         0xff, 0x62, 0x00, 0xff, 0xff, 0x63, 0x00, 0x41, 0x04, 0xf2, 0x03,
-//         0xff, 0xff, 0x64, 0x00, 0xff, 0xff, 0x65, 0x00, 0x35, 0x04, 0xff,
-//         0xff, 0x66, 0x00, 0xff, 0xff, 0x67, 0x00, 0xff, 0xff, 0x68, 0x00,
-//         0xff, 0xff, 0x69, 0x00, 0x56, 0x04, 0xff, 0xff, 0x6a, 0x00, 0x58,
-//         0x04, 0xf3, 0x03, 0xff, 0xff, 0x6b, 0x00, 0xff, 0xff, 0x6c, 0x00,
-//         0xff, 0xff, 0x6d, 0x00, 0xff, 0xff, 0x6e, 0x00, 0xff, 0xff, 0x6f,
-//         0x00, 0x3e, 0x04, 0xbf, 0x03, 0xff, 0xff, 0x70, 0x00, 0x40, 0x04,
-//         0xff, 0xff, 0x71, 0x00, 0x1b, 0x05, 0xff, 0xff, 0x72, 0x00, 0xff,
-//         0xff, 0x73, 0x00, 0x55, 0x04, 0xff, 0xff, 0x74, 0x00, 0xff, 0xff,
-//         0x75, 0x00, 0xff, 0xff, 0x76, 0x00, 0xff, 0xff, 0x77, 0x00, 0x1d,
-//         0x05, 0xff, 0xff, 0x78, 0x00, 0x45, 0x04, 0xff, 0xff, 0x79, 0x00,
-//         0x43, 0x04, 0xff, 0xff, 0x7a, 0x00, 0xff, 0xff, 0x7b, 0x00, 0xff,
-//         0xff, 0x7c, 0x00, 0x23, 0x22, 0xff, 0xff, 0x7d, 0x00, 0xff, 0xff,
-//         0x7e, 0x00, 0xdc, 0x02, 0xc0, 0x1f, 0xff, 0xff, 0x22, 0x20, 0x19,
-//         0x22, 0xcf, 0x25, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xc1, 0x00,
-//         0xff, 0xff, 0xc2, 0x00, 0xff, 0xff, 0xc3, 0x00, 0xff, 0xff, 0xc4,
-//         0x00, 0xd2, 0x04, 0xff, 0xff, 0xc5, 0x00, 0x2b, 0x21, 0xff, 0xff,
-//         0xc6, 0x00, 0xd4, 0x04, 0xff, 0xff, 0xc7, 0x00, 0xff, 0xff, 0xc8,
-//         0x00, 0x00, 0x04, 0xff, 0xff, 0xc9, 0x00, 0xff, 0xff, 0xca, 0x00,
-//         0xff, 0xff, 0xcb, 0x00, 0x01, 0x04, 0xff, 0xff, 0xcc, 0x00, 0xff,
-//         0xff, 0xcd, 0x00, 0xff, 0xff, 0xce, 0x00, 0xff, 0xff, 0xcf, 0x00,
-//         0x07, 0x04, 0xaa, 0x03, 0xff, 0xff, 0xd0, 0x00, 0x10, 0x01, 0xff,
-//         0xff, 0xd1, 0x00, 0xff, 0xff, 0xd2, 0x00, 0xff, 0xff, 0xd3, 0x00,
-//         0xff, 0xff, 0xd4, 0x00, 0xff, 0xff, 0xd5, 0x00, 0xff, 0xff, 0xd6,
-//         0x00, 0xe6, 0x04, 0xff, 0xff, 0xd7, 0x00, 0xff, 0xff, 0xd8, 0x00,
-//         0xff, 0xff, 0xd9, 0x00, 0xff, 0xff, 0xda, 0x00, 0xff, 0xff, 0xdb,
-//         0x00, 0xff, 0xff, 0xdc, 0x00, 0xff, 0xff, 0xdd, 0x00, 0xff, 0xff,
-//         0xde, 0x00, 0xf7, 0x03, 0xff, 0xff, 0xdf, 0x00, 0xff, 0xff, 0x92,
-//         0x25, 0xff, 0xff, 0xa1, 0x00, 0xff, 0xff, 0xa2, 0x00, 0xff, 0xff,
-//         0xa3, 0x00, 0xff, 0xff, 0xac, 0x20, 0xff, 0xff, 0xa5, 0x00, 0xff,
-//         0xff, 0x60, 0x01, 0xff, 0xff, 0xa7, 0x00, 0xff, 0xff, 0x61, 0x01,
-//         0xff, 0xff, 0xa9, 0x00, 0xff, 0xff, 0xaa, 0x00, 0xff, 0xff, 0xab,
-//         0x00, 0xff, 0xff, 0xac, 0x00, 0xff, 0xff, 0xa4, 0x00, 0xff, 0xff,
-//         0xae, 0x00, 0xff, 0xff, 0xaf, 0x00, 0xc9, 0x02, 0xff, 0xff, 0xb0,
-//         0x00, 0xda, 0x02, 0xff, 0xff, 0xb1, 0x00, 0xff, 0xff, 0xb2, 0x00,
-//         0xff, 0xff, 0xb3, 0x00, 0xff, 0xff, 0x7d, 0x01, 0xff, 0xff, 0xb5,
-//         0x00, 0xbc, 0x03, 0xff, 0xff, 0xb6, 0x00, 0xff, 0xff, 0xb7, 0x00,
-//         0x87, 0x03, 0x27, 0x20, 0xc5, 0x22, 0x31, 0x2e, 0xff, 0xff, 0x7e,
-//         0x01, 0xff, 0xff, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff,
-//         0xbb, 0x00, 0xff, 0xff, 0x52, 0x01, 0xff, 0xff, 0x53, 0x01, 0xff,
-//         0xff, 0x78, 0x01, 0xab, 0x03, 0xff, 0xff, 0xbf, 0x00, 0xff, 0xff,
-//         0x00, 0x25, 0x14, 0x20, 0x15, 0x20, 0xaf, 0x23, 0xff, 0xff, 0x02,
-//         0x25, 0xff, 0xff, 0x0c, 0x25, 0x6d, 0x25, 0xff, 0xff, 0x10, 0x25,
-//         0x6e, 0x25, 0xff, 0xff, 0x14, 0x25, 0x70, 0x25, 0xff, 0xff, 0x18,
-//         0x25, 0x6f, 0x25, 0xff, 0xff, 0x1c, 0x25, 0xff, 0xff, 0x24, 0x25,
-//         0xff, 0xff, 0x2c, 0x25, 0xff, 0xff, 0x34, 0x25, 0xff, 0xff, 0x3c,
-//         0x25, 0xff, 0xff, 0x91, 0x25, 0xff, 0xff, 0xba, 0x23, 0x3e, 0x20,
-//         0xff, 0xff, 0xbb, 0x23, 0xff, 0xff, 0xbc, 0x23, 0xff, 0xff, 0xbd,
-//         0x23, 0xff, 0xff, 0x50, 0x25, 0x01, 0x25, 0xff, 0xff, 0x51, 0x25,
-//         0x03, 0x25, 0xff, 0xff, 0x54, 0x25, 0x0f, 0x25, 0xff, 0xff, 0x57,
-//         0x25, 0x13, 0x25, 0xff, 0xff, 0x5a, 0x25, 0x17, 0x25, 0xff, 0xff,
-//         0x5d, 0x25, 0x1b, 0x25, 0xff, 0xff, 0x60, 0x25, 0x23, 0x25, 0xff,
-//         0xff, 0x63, 0x25, 0x2b, 0x25, 0xff, 0xff, 0x66, 0x25, 0x33, 0x25,
-//         0xff, 0xff, 0x69, 0x25, 0x3b, 0x25, 0xff, 0xff, 0x6c, 0x25, 0x4b,
-//         0x25, 0xff, 0xff, 0x88, 0x25, 0xff, 0xff, 0x91, 0x21, 0xff, 0xff,
-//         0x93, 0x21, 0xff, 0xff, 0x90, 0x21, 0xff, 0xff, 0x92, 0x21, 0xff,
-//         0xff, 0xe0, 0x00, 0xff, 0xff, 0xe1, 0x00, 0xff, 0xff, 0xe2, 0x00,
-//         0xff, 0xff, 0xe3, 0x00, 0xff, 0xff, 0xe4, 0x00, 0xd3, 0x04, 0xff,
-//         0xff, 0xe5, 0x00, 0xff, 0xff, 0xe6, 0x00, 0xd5, 0x04, 0xff, 0xff,
-//         0xe7, 0x00, 0xff, 0xff, 0xe8, 0x00, 0x50, 0x04, 0xff, 0xff, 0xe9,
-//         0x00, 0xff, 0xff, 0xea, 0x00, 0xff, 0xff, 0xeb, 0x00, 0x51, 0x04,
-//         0xff, 0xff, 0xec, 0x00, 0xff, 0xff, 0xed, 0x00, 0xff, 0xff, 0xee,
-//         0x00, 0xff, 0xff, 0xef, 0x00, 0x57, 0x04, 0xff, 0xff, 0xf0, 0x00,
-//         0xff, 0xff, 0xf1, 0x00, 0xff, 0xff, 0xf2, 0x00, 0xff, 0xff, 0xf3,
-//         0x00, 0xff, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xf5, 0x00, 0xff, 0xff,
-//         0xf6, 0x00, 0xe7, 0x04, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xf8,
-//         0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfa, 0x00, 0xff, 0xff,
-//         0xfb, 0x00, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff,
-//         0xff, 0xfe, 0x00, 0xf8, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-//         0xb4, 0x00, 0xb9, 0x02, 0xca, 0x02, 0x74, 0x03, 0xfd, 0x1f, 0x32,
-//         0x20, 0xff, 0xff, 0xbb, 0x02, 0xbd, 0x02, 0xfe, 0x1f, 0x18, 0x20,
-//         0x1b, 0x20, 0xff, 0xff, 0x19, 0x20, 0xbd, 0x1f, 0xbf, 0x1f, 0xff,
-//         0xff, 0x36, 0x20, 0xff, 0xff, 0x33, 0x20, 0xba, 0x02, 0xdd, 0x02,
-//         0xff, 0xff, 0x16, 0x21, 0xff, 0xff, 0xb4, 0x20, 0xff, 0xff, 0xbd,
-//         0x20, 0xff, 0xff, 0x11, 0x04, 0x82, 0x01, 0xff, 0xff, 0x13, 0x04,
-//         0x93, 0x03, 0xff, 0xff, 0x14, 0x04, 0xff, 0xff, 0x16, 0x04, 0xff,
-//         0xff, 0x17, 0x04, 0xff, 0xff, 0x18, 0x04, 0x76, 0x03, 0xff, 0xff,
-//         0x19, 0x04, 0xff, 0xff, 0x1b, 0x04, 0xff, 0xff, 0x1f, 0x04, 0xa0,
-//         0x03, 0x0f, 0x22, 0xff, 0xff, 0x23, 0x04, 0xff, 0xff, 0x24, 0x04,
-//         0xa6, 0x03, 0xff, 0xff, 0x26, 0x04, 0xff, 0xff, 0x27, 0x04, 0xff,
-//         0xff, 0x28, 0x04, 0xff, 0xff, 0x29, 0x04, 0xff, 0xff, 0x2a, 0x04,
-//         0xff, 0xff, 0x2b, 0x04, 0xff, 0xff, 0x2c, 0x04, 0xff, 0xff, 0x2d,
-//         0x04, 0xff, 0xff, 0x2e, 0x04, 0xff, 0xff, 0x2f, 0x04, 0xff, 0xff,
-//         0x04, 0x04, 0xff, 0xff, 0x0e, 0x04, 0xff, 0xff, 0x02, 0x04, 0xff,
-//         0xff, 0x03, 0x04, 0xff, 0xff, 0x09, 0x04, 0xff, 0xff, 0x0a, 0x04,
-//         0xff, 0xff, 0x0b, 0x04, 0xff, 0xff, 0x0c, 0x04, 0x30, 0x1e, 0xff,
-//         0xff, 0x0f, 0x04, 0xff, 0xff, 0x90, 0x04, 0xff, 0xff, 0x0d, 0x04,
-//         0xff, 0xff, 0x31, 0x04, 0xff, 0xff, 0x32, 0x04, 0xff, 0xff, 0x33,
-//         0x04, 0xff, 0xff, 0x34, 0x04, 0xff, 0xff, 0x36, 0x04, 0xff, 0xff,
-//         0x37, 0x04, 0xff, 0xff, 0x38, 0x04, 0x77, 0x03, 0xff, 0xff, 0x39,
-//         0x04, 0xff, 0xff, 0x3a, 0x04, 0xff, 0xff, 0x3b, 0x04, 0xff, 0xff,
-//         0x3c, 0x04, 0xff, 0xff, 0x3d, 0x04, 0xff, 0xff, 0x3f, 0x04, 0xff,
-//         0xff, 0x42, 0x04, 0xff, 0xff, 0x44, 0x04, 0xd5, 0x03, 0x78, 0x02,
-//         0xff, 0xff, 0x46, 0x04, 0xff, 0xff, 0x47, 0x04, 0xff, 0xff, 0x48,
-//         0x04, 0xff, 0xff, 0x49, 0x04, 0xff, 0xff, 0x4a, 0x04, 0xff, 0xff,
-//         0x4b, 0x04, 0xff, 0xff, 0x4c, 0x04, 0xff, 0xff, 0x4d, 0x04, 0xf6,
-//         0x03, 0xff, 0xff, 0x4e, 0x04, 0xff, 0xff, 0x4f, 0x04, 0xff, 0xff,
-//         0x54, 0x04, 0xf5, 0x03, 0xff, 0xff, 0x5e, 0x04, 0xff, 0xff, 0x52,
-//         0x04, 0xff, 0xff, 0x53, 0x04, 0xff, 0xff, 0x59, 0x04, 0xff, 0xff,
-//         0x5a, 0x04, 0xff, 0xff, 0x5b, 0x04, 0x27, 0x01, 0xff, 0xff, 0x5c,
-//         0x04, 0xff, 0xff, 0x5f, 0x04, 0xff, 0xff, 0x91, 0x04, 0xff, 0xff,
-//         0x5d, 0x04, 0xff, 0xff, 0x7a, 0x03, 0xbe, 0x1f, 0xff, 0xff, 0x84,
-//         0x03, 0xff, 0xff, 0x85, 0x03, 0xff, 0xff, 0x86, 0x03, 0xff, 0xff,
-//         0x88, 0x03, 0xff, 0xff, 0x89, 0x03, 0xff, 0xff, 0x8a, 0x03, 0xff,
-//         0xff, 0x8c, 0x03, 0xff, 0xff, 0x8e, 0x03, 0xff, 0xff, 0x8f, 0x03,
-//         0xff, 0xff, 0x90, 0x03, 0xff, 0xff, 0x94, 0x03, 0x06, 0x22, 0xff,
-//         0xff, 0x98, 0x03, 0x9f, 0x01, 0xf4, 0x03, 0x72, 0x04, 0xe8, 0x04,
-//         0xff, 0xff, 0x9b, 0x03, 0x45, 0x02, 0xff, 0xff, 0x9e, 0x03, 0xff,
-//         0xff, 0xa3, 0x03, 0xa9, 0x01, 0x11, 0x22, 0xff, 0xff, 0xa8, 0x03,
-//         0xff, 0xff, 0xa9, 0x03, 0x26, 0x21, 0xff, 0xff, 0xac, 0x03, 0xff,
-//         0xff, 0xad, 0x03, 0xff, 0xff, 0xae, 0x03, 0xff, 0xff, 0xaf, 0x03,
-//         0xff, 0xff, 0xb0, 0x03, 0xff, 0xff, 0xb1, 0x03, 0xff, 0xff, 0xb2,
-//         0x03, 0xff, 0xff, 0xb3, 0x03, 0xff, 0xff, 0xb4, 0x03, 0x9f, 0x1e,
-//         0xff, 0xff, 0xb5, 0x03, 0x5b, 0x02, 0xff, 0xff, 0xb6, 0x03, 0xff,
-//         0xff, 0xb7, 0x03, 0x9e, 0x01, 0xff, 0xff, 0xb8, 0x03, 0xff, 0xff,
-//         0xb9, 0x03, 0x69, 0x02, 0xff, 0xff, 0xba, 0x03, 0x38, 0x01, 0xff,
-//         0xff, 0xbb, 0x03, 0xff, 0xff, 0xbd, 0x03, 0xff, 0xff, 0xbe, 0x03,
-//         0xff, 0xff, 0xc1, 0x03, 0xff, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc3,
-//         0x03, 0xff, 0xff, 0xc4, 0x03, 0xff, 0xff, 0xc5, 0x03, 0xff, 0xff,
-//         0xc6, 0x03, 0xff, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc8, 0x03, 0xff,
-//         0xff, 0xc9, 0x03, 0xff, 0xff, 0xca, 0x03, 0xff, 0xff, 0xcb, 0x03,
-//         0xff, 0xff, 0xcc, 0x03, 0xff, 0xff, 0xcd, 0x03, 0xff, 0xff, 0xce,
-//         0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x01, 0xd0, 0x04,
-//         0xff, 0xff, 0x04, 0x01, 0xff, 0xff, 0x02, 0x1e, 0xff, 0xff, 0x06,
-//         0x01, 0xff, 0xff, 0x08, 0x01, 0xff, 0xff, 0x0a, 0x01, 0xff, 0xff,
-//         0x0c, 0x01, 0xff, 0xff, 0x0a, 0x1e, 0xff, 0xff, 0x0e, 0x01, 0xff,
-//         0xff, 0x12, 0x01, 0xff, 0xff, 0x16, 0x01, 0xff, 0xff, 0x1a, 0x01,
-//         0xff, 0xff, 0x18, 0x01, 0xff, 0xff, 0x1e, 0x1e, 0xff, 0xff, 0x1c,
-//         0x01, 0xff, 0xff, 0x20, 0x01, 0xff, 0xff, 0x22, 0x01, 0xff, 0xff,
-//         0x24, 0x01, 0xff, 0xff, 0x26, 0x01, 0xff, 0xff, 0x28, 0x01, 0xff,
-//         0xff, 0x2a, 0x01, 0xff, 0xff, 0x2e, 0x01, 0xff, 0xff, 0x34, 0x01,
-//         0xff, 0xff, 0x36, 0x01, 0xff, 0xff, 0x39, 0x01, 0xff, 0xff, 0x3d,
-//         0x01, 0xff, 0xff, 0x3b, 0x01, 0xff, 0xff, 0x41, 0x01, 0xff, 0xff,
-//         0x40, 0x1e, 0xff, 0xff, 0x43, 0x01, 0xff, 0xff, 0x47, 0x01, 0xff,
-//         0xff, 0x45, 0x01, 0xff, 0xff, 0x4a, 0x01, 0xff, 0xff, 0x4c, 0x01,
-//         0xff, 0xff, 0x50, 0x01, 0xff, 0xff, 0x56, 0x1e, 0xff, 0xff, 0x54,
-//         0x01, 0xff, 0xff, 0x58, 0x01, 0xff, 0xff, 0x56, 0x01, 0xff, 0xff,
-//         0x5a, 0x01, 0xff, 0xff, 0x5c, 0x01, 0xff, 0xff, 0x60, 0x1e, 0xff,
-//         0xff, 0x18, 0x02, 0xff, 0xff, 0x6a, 0x1e, 0xff, 0xff, 0x64, 0x01,
-//         0xff, 0xff, 0x1a, 0x02, 0xff, 0xff, 0x62, 0x01, 0xff, 0xff, 0x66,
-//         0x01, 0xff, 0xff, 0x68, 0x01, 0xff, 0xff, 0x6a, 0x01, 0xff, 0xff,
-//         0x6c, 0x01, 0xff, 0xff, 0x6e, 0x01, 0xff, 0xff, 0x70, 0x01, 0xff,
-//         0xff, 0x72, 0x01, 0xff, 0xff, 0x80, 0x1e, 0xff, 0xff, 0x82, 0x1e,
-//         0xff, 0xff, 0x74, 0x01, 0xff, 0xff, 0x84, 0x1e, 0xff, 0xff, 0xf2,
-//         0x1e, 0xff, 0xff, 0x76, 0x01, 0xff, 0xff, 0x79, 0x01, 0xff, 0xff,
-//         0x7b, 0x01, 0xff, 0xff, 0x01, 0x01, 0xff, 0xff, 0x03, 0x01, 0xd1,
-//         0x04, 0xff, 0xff, 0x05, 0x01, 0xff, 0xff, 0x03, 0x1e, 0xff, 0xff,
-//         0x07, 0x01, 0xff, 0xff, 0x09, 0x01, 0xff, 0xff, 0x0b, 0x01, 0xff,
-//         0xff, 0x0d, 0x01, 0xff, 0xff, 0x0b, 0x1e, 0xff, 0xff, 0x0f, 0x01,
-//         0xff, 0xff, 0x11, 0x01, 0xff, 0xff, 0x13, 0x01, 0xff, 0xff, 0x17,
-//         0x01, 0xff, 0xff, 0x1b, 0x01, 0xff, 0xff, 0x19, 0x01, 0xff, 0xff,
-//         0x1f, 0x1e, 0xff, 0xff, 0x1d, 0x01, 0xff, 0xff, 0x21, 0x01, 0xff,
-//         0xff, 0x23, 0x01, 0xff, 0xff, 0x25, 0x01, 0xff, 0xff, 0x29, 0x01,
-//         0xff, 0xff, 0x2b, 0x01, 0xff, 0xff, 0x2f, 0x01, 0xff, 0xff, 0x35,
-//         0x01, 0xff, 0xff, 0x37, 0x01, 0xff, 0xff, 0x3a, 0x01, 0xff, 0xff,
-//         0x3e, 0x01, 0xff, 0xff, 0x3c, 0x01, 0xff, 0xff, 0x42, 0x01, 0xff,
-//         0xff, 0x41, 0x1e, 0xff, 0xff, 0x44, 0x01, 0xff, 0xff, 0x48, 0x01,
-//         0xff, 0xff, 0x46, 0x01, 0xff, 0xff, 0x4b, 0x01, 0xff, 0xff, 0x4d,
-//         0x01, 0xff, 0xff, 0x51, 0x01, 0xff, 0xff, 0x57, 0x1e, 0xff, 0xff,
-//         0x55, 0x01, 0xff, 0xff, 0x59, 0x01, 0xff, 0xff, 0x57, 0x01, 0xff,
-//         0xff, 0x5b, 0x01, 0xff, 0xff, 0x5d, 0x01, 0xff, 0xff, 0x61, 0x1e,
-//         0xff, 0xff, 0x19, 0x02, 0xff, 0xff, 0x6b, 0x1e, 0xff, 0xff, 0x65,
-//         0x01, 0xff, 0xff, 0x1b, 0x02, 0xff, 0xff, 0x63, 0x01, 0xff, 0xff,
-//         0x67, 0x01, 0xff, 0xff, 0x69, 0x01, 0xff, 0xff, 0x6b, 0x01, 0xff,
-//         0xff, 0x6d, 0x01, 0xff, 0xff, 0x6f, 0x01, 0xff, 0xff, 0x71, 0x01,
-//         0xff, 0xff, 0x73, 0x01, 0xff, 0xff, 0x81, 0x1e, 0xff, 0xff, 0x83,
-//         0x1e, 0xff, 0xff, 0x75, 0x01, 0xff, 0xff, 0x85, 0x1e, 0xff, 0xff,
-//         0xf3, 0x1e, 0xff, 0xff, 0x77, 0x01, 0xff, 0xff, 0x7a, 0x01, 0xff,
-//         0xff, 0x7c, 0x01, 0xff, 0xff, 0xd8, 0x02, 0xff, 0xff, 0xd9, 0x02,
-//         0xff, 0xff, 0xc7, 0x02, 0xff, 0xff, 0xdb, 0x02, 0xff, 0xff};
-// size_t font_len   = 7050;
-// size_t font_count = 512;
-//
-// volatile uint32_t *framebuffer;
-// size_t             framebuffer_pitch;
-// size_t             framebuffer_bpp;
-//
-// int pfs_puts(const char *str)
-// {
-//     int    x             = 0;
-//     int    y             = 0;
-//     int    dx            = 0;
-//     int    mask          = 0;
-//     size_t line          = 0;
-//     size_t offset        = 0;
-//
-//     psf1_header_t h      = (( psf1_header_t * )font)[0];
-//     size_t        height = h.glyph_size;
-//
-//     while (*str) {
-//         uint8_t *glyph =
-//                 ( uint8_t * )font +
-//                 (sizeof(h) +
-//                  ((*str > 0 && *str < font_count) ? *str : 0) * PSF1_WIDTH);
-//         offset = (dx + (PSF1_WIDTH * framebuffer_pitch));
-//         for (y = 0; y < height; ++y) {
-//             line                                 = offset;
-//             mask                                 = 1 << (PSF1_WIDTH - 1);
-//             *(( uint32_t * )framebuffer + line)  = 0;
-//             glyph                               += PSF1_WIDTH;
-//             offset                              += framebuffer_bpp;
-//         }
-//         ++str;
-//         ++dx;
-//     }
-//
-//     return strlen(str);
-// }
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <kernel/fb.h>
+#include <kernel/psf.h>
+
+static const uint8_t psf_default_font[] = {
+        0x36, 0x04, 0x03, 0x09, 0x7e, 0xc3, 0x99, 0xf3, 0xe7, 0xff, 0xe7,
+        0x7e, 0x00, 0x00, 0x00, 0x7f, 0xe6, 0x66, 0x66, 0xc3, 0x00, 0x00,
+        0x0c, 0x18, 0xfc, 0x30, 0xfc, 0x60, 0xc0, 0x00, 0x00, 0x18, 0x30,
+        0x60, 0x30, 0x18, 0x00, 0x7c, 0x00, 0x00, 0x60, 0x30, 0x18, 0x30,
+        0x60, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+        0x00, 0x00, 0x00, 0x10, 0x38, 0x7c, 0xfe, 0x7c, 0x38, 0x10, 0x00,
+        0x00, 0xc3, 0xc6, 0xcc, 0xd8, 0x36, 0x6e, 0xd6, 0xbf, 0x06, 0xc3,
+        0xc6, 0xcc, 0xd8, 0x36, 0x6b, 0xc6, 0x8c, 0x0f, 0xe1, 0x33, 0x66,
+        0x34, 0xea, 0x36, 0x6a, 0xdf, 0x82, 0x18, 0x18, 0x18, 0x18, 0x00,
+        0x18, 0x18, 0x18, 0x18, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x78, 0x00,
+        0x0e, 0x1b, 0x18, 0x3c, 0x18, 0x18, 0xd8, 0x70, 0x00, 0x18, 0x18,
+        0x7e, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x7e, 0x18,
+        0x7e, 0x18, 0x18, 0x00, 0x00, 0x00, 0xcc, 0xd8, 0x30, 0x60, 0xdb,
+        0x9b, 0x00, 0x00, 0xf1, 0x5b, 0x55, 0x51, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xdb, 0x00, 0x00, 0x00,
+        0x0c, 0x18, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18,
+        0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x66, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xcc, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x66, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0x18, 0x0c, 0x00, 0xc6, 0x7c, 0x7e, 0xc0,
+        0xce, 0xc6, 0x7e, 0x00, 0x00, 0xc6, 0x7c, 0x00, 0x76, 0xcc, 0x7c,
+        0x0c, 0xf8, 0x00, 0x30, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00,
+        0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x78,
+        0xc4, 0x70, 0x38, 0x8c, 0x78, 0x0c, 0x78, 0x00, 0x00, 0x7c, 0xc0,
+        0x78, 0x0c, 0xf8, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x78, 0x30, 0x30, 0x00, 0x30,
+        0x00, 0x00, 0x6c, 0x6c, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x00, 0x10, 0x7c,
+        0xd0, 0x7c, 0x16, 0x7c, 0x10, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0x18,
+        0x30, 0x66, 0xc6, 0x00, 0x00, 0x38, 0x6c, 0x38, 0x76, 0xdc, 0xcc,
+        0x76, 0x00, 0x00, 0x18, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x30, 0x60, 0x60, 0x60, 0x30, 0x18, 0x00, 0x00, 0x60,
+        0x30, 0x18, 0x18, 0x18, 0x30, 0x60, 0x00, 0x00, 0x00, 0x6c, 0x38,
+        0xfe, 0x38, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xfc, 0x30,
+        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+        0x30, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x06, 0x0c,
+        0x18, 0x30, 0x60, 0xc0, 0x80, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xd6,
+        0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x30, 0x70, 0x30, 0x30, 0x30, 0x30,
+        0xfc, 0x00, 0x00, 0x78, 0xcc, 0x0c, 0x38, 0x60, 0xcc, 0xfc, 0x00,
+        0x00, 0x78, 0xcc, 0x0c, 0x38, 0x0c, 0xcc, 0x78, 0x00, 0x00, 0x1c,
+        0x3c, 0x6c, 0xcc, 0xfe, 0x0c, 0x1e, 0x00, 0x00, 0xfc, 0xc0, 0xf8,
+        0x0c, 0x0c, 0xcc, 0x78, 0x00, 0x00, 0x38, 0x60, 0xc0, 0xf8, 0xcc,
+        0xcc, 0x78, 0x00, 0x00, 0xfc, 0xcc, 0x0c, 0x18, 0x30, 0x30, 0x30,
+        0x00, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0xcc, 0xcc, 0x78, 0x00, 0x00,
+        0x78, 0xcc, 0xcc, 0x7c, 0x0c, 0x18, 0x70, 0x00, 0x00, 0x00, 0x30,
+        0x30, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,
+        0x00, 0x30, 0x30, 0x60, 0x00, 0x18, 0x30, 0x60, 0xc0, 0x60, 0x30,
+        0x18, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x60, 0x00, 0x00, 0x78,
+        0xcc, 0x0c, 0x18, 0x30, 0x00, 0x30, 0x00, 0x00, 0x7c, 0xc6, 0xde,
+        0xde, 0xdc, 0xc0, 0x78, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe,
+        0xc6, 0xc6, 0x00, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc,
+        0x00, 0x00, 0x3c, 0x66, 0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x00, 0x00,
+        0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c, 0xf8, 0x00, 0x00, 0xfe, 0x62,
+        0x68, 0x78, 0x68, 0x62, 0xfe, 0x00, 0x00, 0xfe, 0x62, 0x68, 0x78,
+        0x68, 0x60, 0xf0, 0x00, 0x00, 0x3c, 0x66, 0xc0, 0xc0, 0xce, 0x66,
+        0x3e, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00,
+        0x00, 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x1e,
+        0x0c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0xe6, 0x66, 0x6c,
+        0x78, 0x6c, 0x66, 0xe6, 0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x62,
+        0x66, 0xfe, 0x00, 0x00, 0xc6, 0xee, 0xfe, 0xfe, 0xd6, 0xc6, 0xc6,
+        0x00, 0x00, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0xc6, 0x00, 0x00,
+        0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0xfc, 0x66,
+        0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6,
+        0xc6, 0xce, 0x7c, 0x0e, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x6c, 0x66,
+        0xe6, 0x00, 0x00, 0x78, 0xcc, 0xe0, 0x78, 0x1c, 0xcc, 0x78, 0x00,
+        0x00, 0xfc, 0xb4, 0x30, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0xc6,
+        0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+        0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xd6, 0xd6,
+        0xfe, 0x6c, 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x6c, 0xc6, 0xc6,
+        0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x78, 0x30, 0x30, 0x78, 0x00, 0x00,
+        0xfe, 0xcc, 0x98, 0x30, 0x62, 0xc6, 0xfe, 0x00, 0x00, 0x78, 0x60,
+        0x60, 0x60, 0x60, 0x60, 0x78, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x18,
+        0x0c, 0x06, 0x02, 0x00, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18,
+        0x78, 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x30,
+        0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+        0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0xe0, 0x60, 0x60, 0x7c, 0x66,
+        0x66, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78,
+        0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00,
+        0x00, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x38, 0x6c,
+        0x60, 0xf0, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc,
+        0xcc, 0x7c, 0x0c, 0xf8, 0x00, 0xe0, 0x60, 0x6c, 0x76, 0x66, 0x66,
+        0xe6, 0x00, 0x00, 0x30, 0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00,
+        0x00, 0x0c, 0x00, 0x1c, 0x0c, 0x0c, 0xcc, 0xcc, 0x78, 0x00, 0xe0,
+        0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x00, 0x00, 0x70, 0x30, 0x30,
+        0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6,
+        0xd6, 0xd6, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66,
+        0x00, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00, 0x00,
+        0x00, 0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x00,
+        0x76, 0xcc, 0xcc, 0x7c, 0x0c, 0x1e, 0x00, 0x00, 0x00, 0xdc, 0x76,
+        0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc0, 0x78, 0x0c,
+        0xf8, 0x00, 0x00, 0x10, 0x30, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00,
+        0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00,
+        0x00, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0xc6,
+        0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38,
+        0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c,
+        0xf8, 0x00, 0x00, 0x00, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00,
+        0x1c, 0x30, 0x30, 0xe0, 0x30, 0x30, 0x1c, 0x00, 0x00, 0x18, 0x18,
+        0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0xe0, 0x30, 0x30, 0x1c,
+        0x30, 0x30, 0xe0, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00,
+        0x00, 0xc0, 0x60, 0x1c, 0x36, 0x63, 0x7f, 0x63, 0x00, 0x00, 0x03,
+        0x06, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0x10, 0x28, 0x00,
+        0x7c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6,
+        0xfe, 0xc6, 0x00, 0x00, 0x6c, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6,
+        0x00, 0x00, 0x38, 0x6c, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00, 0x00,
+        0x3f, 0x6d, 0xcc, 0xff, 0xcc, 0xcd, 0xcf, 0x00, 0x00, 0x3c, 0x66,
+        0xc0, 0xc0, 0x66, 0x3c, 0x06, 0x3c, 0x00, 0x60, 0x30, 0xfe, 0x62,
+        0x78, 0x62, 0xfe, 0x00, 0x00, 0x0c, 0x18, 0xfe, 0x62, 0x78, 0x62,
+        0xfe, 0x00, 0x00, 0x10, 0x28, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00,
+        0x00, 0x6c, 0x00, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x60,
+        0x30, 0x00, 0x78, 0x30, 0x30, 0x78, 0x00, 0x00, 0x18, 0x30, 0x00,
+        0x78, 0x30, 0x30, 0x78, 0x00, 0x00, 0x20, 0x50, 0x00, 0x78, 0x30,
+        0x30, 0x78, 0x00, 0x00, 0xcc, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78,
+        0x00, 0x00, 0xf8, 0x6c, 0x66, 0xf6, 0x66, 0x6c, 0xf8, 0x00, 0x00,
+        0x76, 0xdc, 0x00, 0xe6, 0xf6, 0xde, 0xce, 0x00, 0x00, 0x60, 0x30,
+        0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x0c, 0x18, 0x00, 0x7c,
+        0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x10, 0x28, 0x00, 0x7c, 0xc6, 0xc6,
+        0x7c, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00,
+        0x00, 0x6c, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00,
+        0x00, 0x6c, 0x38, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x67, 0x6e,
+        0x7e, 0x76, 0xe6, 0xbc, 0x00, 0x00, 0x60, 0x30, 0x00, 0xc6, 0xc6,
+        0xc6, 0x7c, 0x00, 0x00, 0x0c, 0x18, 0x00, 0xc6, 0xc6, 0xc6, 0x7c,
+        0x00, 0x00, 0x10, 0x28, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00,
+        0x6c, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x18, 0x30,
+        0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00, 0xf0, 0x60, 0x7c, 0x66,
+        0x7c, 0x60, 0xf0, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xd8, 0xcc, 0xc6,
+        0xcc, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+        0xaa, 0x30, 0x00, 0x30, 0x30, 0x78, 0x78, 0x30, 0x00, 0x00, 0x00,
+        0x10, 0x7c, 0xd6, 0xd0, 0xd6, 0x7c, 0x10, 0x00, 0x38, 0x6c, 0x64,
+        0xf0, 0x60, 0x66, 0xfc, 0x00, 0x00, 0x1e, 0x31, 0xfc, 0x60, 0xf8,
+        0x33, 0x1e, 0x00, 0x00, 0xcc, 0xcc, 0x78, 0xfc, 0x30, 0xfc, 0x30,
+        0x00, 0x00, 0x28, 0x10, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00,
+        0x3e, 0x61, 0x3c, 0x66, 0x66, 0x3c, 0x86, 0x7c, 0x00, 0x28, 0x10,
+        0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00, 0x3c, 0x42, 0x99, 0xa1,
+        0xa1, 0x99, 0x42, 0x3c, 0x00, 0x3c, 0x6c, 0x6c, 0x3e, 0x00, 0x7e,
+        0x00, 0x00, 0x00, 0x00, 0x33, 0x66, 0xcc, 0x66, 0x33, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xfc, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+        0x66, 0x3c, 0x66, 0x66, 0x3c, 0x66, 0x00, 0x00, 0x3c, 0x42, 0xb9,
+        0xa5, 0xb9, 0xa5, 0x42, 0x3c, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x00, 0xfc, 0x00, 0x00,
+        0x38, 0x6c, 0x18, 0x30, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c,
+        0x38, 0x0c, 0x78, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0xfc, 0x98,
+        0x30, 0x64, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x66, 0x66,
+        0x7b, 0xc0, 0x00, 0x7f, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x50,
+        0x20, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00, 0x18, 0x38, 0x18,
+        0x18, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6c, 0x6c, 0x38, 0x00,
+        0x7c, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x66, 0xcc, 0x00,
+        0x00, 0x00, 0x7f, 0xcd, 0xcc, 0xcf, 0xcc, 0xcd, 0x7f, 0x00, 0x00,
+        0x00, 0x00, 0x7e, 0xdb, 0xde, 0xd8, 0x7e, 0x00, 0x00, 0xcc, 0x00,
+        0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00, 0x30, 0x00, 0x30, 0x60,
+        0xc0, 0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+        0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+        0x18, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x18, 0x18, 0x18, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+        0x18, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0xf8,
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x1f, 0x18, 0x18,
+        0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xf8, 0x18, 0x18, 0x18, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+        0x18, 0x18, 0xff, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18,
+        0xff, 0x18, 0x18, 0x18, 0x18, 0x88, 0x22, 0x88, 0x22, 0x88, 0x22,
+        0x88, 0x22, 0x88, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00,
+        0xff, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+        0x36, 0x36, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x37, 0x36, 0x36, 0x36,
+        0x00, 0x00, 0x00, 0xfe, 0x06, 0xf6, 0x36, 0x36, 0x36, 0x36, 0x36,
+        0x36, 0x37, 0x30, 0x3f, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0xf6,
+        0x06, 0xfe, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36, 0x37, 0x30, 0x37,
+        0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0xf6, 0x06, 0xf6, 0x36, 0x36,
+        0x36, 0x00, 0x00, 0x00, 0xff, 0x00, 0xf7, 0x36, 0x36, 0x36, 0x36,
+        0x36, 0x36, 0xf7, 0x00, 0xff, 0x00, 0x00, 0x00, 0x36, 0x36, 0x36,
+        0xf7, 0x00, 0xf7, 0x36, 0x36, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0x18, 0x3c, 0x7e, 0x18, 0x18, 0x18, 0x18,
+        0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x7e, 0x3c, 0x18, 0x00, 0x00,
+        0x00, 0x18, 0x30, 0x7f, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0x0c, 0xfe, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x60, 0x30, 0x78, 0x0c,
+        0x7c, 0xcc, 0x76, 0x00, 0x00, 0x18, 0x30, 0x78, 0x0c, 0x7c, 0xcc,
+        0x76, 0x00, 0x00, 0x10, 0x28, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00,
+        0x00, 0x76, 0xdc, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0x6c,
+        0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0x38, 0x6c, 0x38,
+        0x0c, 0x7c, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x1b, 0x7e,
+        0xd8, 0x6e, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x0c,
+        0x78, 0x00, 0x60, 0x30, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00,
+        0x18, 0x30, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x10, 0x28,
+        0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x6c, 0x00, 0x78, 0xcc,
+        0xfc, 0xc0, 0x78, 0x00, 0x00, 0x60, 0x30, 0x00, 0x70, 0x30, 0x30,
+        0x78, 0x00, 0x00, 0x18, 0x30, 0x00, 0x70, 0x30, 0x30, 0x78, 0x00,
+        0x00, 0x20, 0x50, 0x00, 0x70, 0x30, 0x30, 0x78, 0x00, 0x00, 0xd8,
+        0x00, 0x70, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x34, 0x18, 0x2c,
+        0x7c, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x76, 0xdc, 0x00, 0xdc, 0x66,
+        0x66, 0x66, 0x00, 0x00, 0x60, 0x30, 0x00, 0x7c, 0xc6, 0xc6, 0x7c,
+        0x00, 0x00, 0x0c, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00,
+        0x10, 0x28, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x76, 0xdc,
+        0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x7c,
+        0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x30, 0x30, 0x00, 0xfc, 0x00, 0x30,
+        0x30, 0x00, 0x00, 0x00, 0x3d, 0x66, 0x6e, 0x76, 0x66, 0xbc, 0x00,
+        0x00, 0x60, 0x30, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x18,
+        0x30, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x20, 0x50, 0x00,
+        0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0xcc, 0x00, 0xcc, 0xcc, 0xcc,
+        0xcc, 0x76, 0x00, 0x00, 0x18, 0x30, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c,
+        0xf8, 0x00, 0xe0, 0x60, 0x7c, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00,
+        0xcc, 0x00, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xf8, 0x00, 0x0c, 0x18,
+        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xcc, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x33, 0x66, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x9b, 0xdb, 0xf8, 0xdb, 0xd8, 0xd8, 0x00, 0x00, 0x7c, 0x06, 0xff,
+        0x18, 0xff, 0x60, 0x3e, 0x00, 0x00, 0xfc, 0x66, 0xfc, 0x60, 0xfe,
+        0x60, 0xf0, 0x00, 0x00, 0xfc, 0xc0, 0xc0, 0xfc, 0xc6, 0xc6, 0xfc,
+        0x00, 0x00, 0xfe, 0xc6, 0xc2, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+        0x3c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6, 0x00, 0xd6, 0xd6,
+        0x7c, 0x38, 0x7c, 0xd6, 0xd6, 0x00, 0x00, 0x7c, 0xc6, 0x06, 0x7c,
+        0x06, 0xc6, 0x7c, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0xde, 0xf6, 0xe6,
+        0xc6, 0x00, 0x00, 0xda, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0xc6, 0x00,
+        0x00, 0x3e, 0x76, 0x66, 0x66, 0x66, 0xe6, 0xc6, 0x00, 0x00, 0xfe,
+        0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+        0x7e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x10, 0x7c, 0xd6, 0xd6, 0xd6,
+        0xd6, 0x7c, 0x10, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xfe,
+        0x06, 0x00, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x06, 0x06, 0x00, 0x00,
+        0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xd6, 0xfe, 0x00, 0x00, 0xd6, 0xd6,
+        0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03, 0x00, 0xf0, 0xb0, 0x30, 0x3c,
+        0x36, 0x36, 0x3c, 0x00, 0x00, 0xc2, 0xc2, 0xc2, 0xf2, 0xda, 0xda,
+        0xf2, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xf8, 0xcc, 0xcc, 0xf8, 0x00,
+        0x00, 0x7c, 0xc6, 0x06, 0x7e, 0x06, 0xc6, 0x7c, 0x00, 0x00, 0x9c,
+        0xb6, 0xb6, 0xf6, 0xb6, 0xb6, 0x9c, 0x00, 0x00, 0x7e, 0xcc, 0xcc,
+        0x7c, 0x6c, 0xcc, 0xce, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xfc, 0xc0,
+        0xc6, 0x7c, 0x00, 0x00, 0xda, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c,
+        0x00, 0x00, 0xfc, 0x30, 0x30, 0x3c, 0x36, 0x36, 0x26, 0x0c, 0x00,
+        0x0c, 0x18, 0xfe, 0xc6, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x3c, 0x6c,
+        0x6c, 0x6e, 0x6a, 0xea, 0xce, 0x00, 0x00, 0xd8, 0xd8, 0xd8, 0xfe,
+        0xda, 0xda, 0xde, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x3c, 0x36, 0x36,
+        0x36, 0x00, 0x00, 0xda, 0xd6, 0xcc, 0xf8, 0xcc, 0xc6, 0xc6, 0x00,
+        0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0x10, 0x00, 0x06,
+        0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0xb6, 0xd6, 0xce,
+        0xde, 0xf6, 0xe6, 0xc6, 0x00, 0x00, 0x0c, 0x38, 0xe0, 0xf8, 0xcc,
+        0xcc, 0x78, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcc, 0xf8, 0xcc, 0xf8,
+        0x00, 0x00, 0x00, 0x00, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00,
+        0x00, 0x00, 0x3c, 0x6c, 0x6c, 0x6c, 0xfe, 0xc6, 0x00, 0x00, 0x00,
+        0xd6, 0x54, 0x38, 0x54, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6,
+        0x1c, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xce, 0xde, 0xf6,
+        0xe6, 0x00, 0x00, 0x6c, 0x38, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00,
+        0x00, 0x00, 0x00, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0x00, 0x00, 0x00,
+        0x00, 0x3e, 0x76, 0x66, 0xe6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xc6,
+        0xee, 0xfe, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xfc,
+        0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc,
+        0x00, 0x00, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+        0x00, 0x10, 0x7c, 0xd6, 0xd6, 0x7c, 0x10, 0x10, 0x00, 0x00, 0x00,
+        0xcc, 0xcc, 0xcc, 0xcc, 0xfe, 0x06, 0x00, 0x00, 0x00, 0xcc, 0xcc,
+        0x7c, 0x0c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6,
+        0xfe, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0xff, 0x03,
+        0x00, 0x00, 0x00, 0xf0, 0x30, 0x3c, 0x36, 0x3c, 0x00, 0x00, 0x00,
+        0x00, 0xc2, 0xc2, 0xf2, 0xda, 0xf2, 0x00, 0x00, 0x00, 0x00, 0xc0,
+        0xc0, 0xf8, 0xcc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0x1e,
+        0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xb6, 0xf6, 0xb6, 0x9c,
+        0x00, 0x00, 0x00, 0x00, 0x7e, 0xc6, 0x7e, 0x36, 0xe6, 0x00, 0x00,
+        0x00, 0x00, 0x7c, 0xc6, 0xf0, 0xc6, 0x7c, 0x00, 0x00, 0x6c, 0x38,
+        0x00, 0xc6, 0xc6, 0x7e, 0x06, 0x7c, 0x00, 0x60, 0xfc, 0x60, 0x7c,
+        0x66, 0x66, 0x46, 0x0c, 0x00, 0x0c, 0x18, 0xfe, 0xc0, 0xc0, 0xc0,
+        0xc0, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x6c, 0x6e, 0xea, 0xce, 0x00,
+        0x00, 0x00, 0x00, 0xd8, 0xd8, 0xfe, 0xda, 0xde, 0x00, 0x00, 0x60,
+        0xfc, 0x60, 0x7c, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x0c, 0x18, 0xc6,
+        0xcc, 0xf8, 0xcc, 0xc6, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6,
+        0xc6, 0xfe, 0x10, 0x00, 0x04, 0x0c, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0,
+        0x00, 0x00, 0x60, 0x30, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0x00, 0x10, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x54, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xbc, 0x66, 0x66, 0x7e, 0x66,
+        0x66, 0x00, 0x00, 0xbe, 0xb2, 0x30, 0x3c, 0x30, 0x32, 0x3e, 0x00,
+        0x00, 0xb6, 0xb6, 0x36, 0x3e, 0x36, 0x36, 0x36, 0x00, 0x00, 0xbc,
+        0x98, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x9c, 0xb6, 0x36,
+        0x36, 0x36, 0x36, 0x1c, 0x00, 0x00, 0xb3, 0xb3, 0x33, 0x1e, 0x0c,
+        0x0c, 0x1e, 0x00, 0x00, 0x9c, 0xb6, 0x36, 0x36, 0x36, 0x14, 0x77,
+        0x00, 0x00, 0x10, 0x54, 0x00, 0x70, 0x30, 0x30, 0x18, 0x00, 0x00,
+        0x10, 0x38, 0x38, 0x6c, 0x6c, 0xc6, 0xfe, 0x00, 0x00, 0x7c, 0xc6,
+        0xc6, 0xfe, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x10, 0x38, 0x38, 0x6c,
+        0x6c, 0xc6, 0xc6, 0x00, 0x00, 0xfe, 0xc6, 0x00, 0x7c, 0x00, 0xc6,
+        0xfe, 0x00, 0x00, 0xfc, 0xc4, 0x60, 0x30, 0x60, 0xc4, 0xfc, 0x00,
+        0x00, 0xd6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x38, 0x00, 0x00, 0x7c,
+        0xc6, 0xc6, 0xc6, 0x6c, 0x6c, 0xee, 0x00, 0x00, 0x10, 0x10, 0x76,
+        0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x08, 0x08, 0x3c, 0x60, 0x38,
+        0x60, 0x3c, 0x00, 0x00, 0x10, 0x10, 0xb8, 0xcc, 0xcc, 0xcc, 0xcc,
+        0x0c, 0x00, 0x10, 0x10, 0x70, 0x30, 0x30, 0x30, 0x18, 0x00, 0x00,
+        0x10, 0x54, 0x00, 0xe6, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00,
+        0x76, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x7c, 0xc6, 0xcc, 0xdc,
+        0xc6, 0xc6, 0xdc, 0xc0, 0x00, 0x00, 0x00, 0xe6, 0x36, 0x1c, 0x36,
+        0x36, 0x1c, 0x00, 0x1e, 0x30, 0x18, 0x7c, 0xc6, 0xc6, 0x7c, 0x00,
+        0x00, 0x00, 0x00, 0x3c, 0x60, 0x38, 0x60, 0x3c, 0x00, 0x00, 0xfe,
+        0x18, 0x30, 0x30, 0x1c, 0x0c, 0x18, 0x00, 0x00, 0x00, 0x00, 0xb8,
+        0xcc, 0xcc, 0xcc, 0xcc, 0x0c, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6,
+        0x6c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0xc6, 0xcc, 0xf8, 0xcc, 0xc6, 0x00, 0x00,
+        0x70, 0x18, 0x0c, 0x1c, 0x36, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
+        0xc6, 0xc6, 0xcc, 0xd8, 0xf0, 0x00, 0x00, 0x7e, 0x18, 0x30, 0x1c,
+        0x30, 0x18, 0x18, 0x70, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xcc, 0xf8,
+        0xc0, 0xc0, 0x00, 0x00, 0x00, 0x78, 0xcc, 0xc0, 0x78, 0x0c, 0x38,
+        0x00, 0x00, 0x00, 0x7e, 0xd8, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x00,
+        0x00, 0xfe, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xe6,
+        0x66, 0x66, 0x66, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd6, 0xd6,
+        0xd6, 0x7c, 0x10, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6,
+        0xc6, 0x00, 0x00, 0x00, 0xc6, 0xd6, 0xd6, 0xd6, 0x7c, 0x10, 0x00,
+        0x00, 0x00, 0x6c, 0xc6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x48, 0x00,
+        0x70, 0x30, 0x30, 0x30, 0x18, 0x00, 0x00, 0x24, 0x00, 0xe6, 0x66,
+        0x66, 0x66, 0x3c, 0x00, 0x00, 0x20, 0x20, 0x78, 0xcc, 0xcc, 0xcc,
+        0x78, 0x00, 0x00, 0x10, 0x10, 0xe6, 0x66, 0x66, 0x66, 0x3c, 0x00,
+        0x00, 0x10, 0x10, 0x44, 0xc6, 0xd6, 0xd6, 0x6c, 0x00, 0x00, 0x7c,
+        0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0xc6, 0x7c, 0x00,
+        0x7c, 0xc6, 0xfe, 0xc6, 0x00, 0x00, 0x38, 0x6c, 0xc6, 0xfe, 0xc6,
+        0xce, 0x0c, 0x07, 0x00, 0x18, 0x00, 0xfc, 0x66, 0x7c, 0x66, 0xfc,
+        0x00, 0x00, 0x0c, 0x18, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00, 0x00,
+        0x08, 0x14, 0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00, 0x00, 0x18, 0x00,
+        0x3c, 0x66, 0x60, 0x66, 0x3c, 0x00, 0x00, 0x28, 0x10, 0x3c, 0x66,
+        0x60, 0x66, 0x3c, 0x00, 0x00, 0x18, 0x00, 0xf8, 0x6c, 0x66, 0x6c,
+        0xf8, 0x00, 0x00, 0x28, 0x10, 0xf8, 0x6c, 0x66, 0x6c, 0xf8, 0x00,
+        0x00, 0x7c, 0x00, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x18,
+        0x00, 0xfe, 0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x28, 0x10, 0xfe,
+        0x62, 0x78, 0x62, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x62, 0x78, 0x62,
+        0xfe, 0x30, 0x1e, 0x00, 0x18, 0x00, 0xfe, 0x62, 0x78, 0x60, 0xf0,
+        0x00, 0x00, 0x10, 0x28, 0x7e, 0xc0, 0xce, 0xc6, 0x7e, 0x00, 0x00,
+        0x18, 0x00, 0x7e, 0xc0, 0xce, 0xc6, 0x7e, 0x00, 0x00, 0x3c, 0x66,
+        0xc0, 0xce, 0x66, 0x3e, 0x0c, 0x78, 0x00, 0x10, 0x28, 0xc6, 0xc6,
+        0xfe, 0xc6, 0xc6, 0x00, 0x00, 0x66, 0xff, 0x66, 0x7e, 0x66, 0x66,
+        0x66, 0x00, 0x00, 0x76, 0xdc, 0x00, 0x3c, 0x18, 0x18, 0x3c, 0x00,
+        0x00, 0xf8, 0x00, 0x78, 0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x78,
+        0x30, 0x30, 0x30, 0x30, 0x78, 0x30, 0x1e, 0x00, 0x4f, 0xa6, 0x06,
+        0x06, 0x66, 0x66, 0x3c, 0x00, 0x00, 0xe6, 0x6c, 0x78, 0x6c, 0x66,
+        0xe6, 0x30, 0xe0, 0x00, 0xf3, 0x66, 0x60, 0x60, 0x62, 0x66, 0xfe,
+        0x00, 0x00, 0xf5, 0x62, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00,
+        0xf0, 0x60, 0x60, 0x60, 0x66, 0xfe, 0x0c, 0x78, 0x00, 0xe0, 0x60,
+        0x78, 0xe0, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x18, 0xc6, 0xee, 0xfe,
+        0xfe, 0xd6, 0xc6, 0x00, 0x00, 0x0c, 0x18, 0xe6, 0xf6, 0xde, 0xce,
+        0xc6, 0x00, 0x00, 0x28, 0x10, 0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00,
+        0x00, 0xc6, 0xe6, 0xf6, 0xde, 0xce, 0xe6, 0x30, 0xe0, 0x00, 0xc6,
+        0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x06, 0x1c, 0x00, 0x7c, 0x00, 0x7c,
+        0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x33, 0x66, 0x00, 0x7c, 0xc6,
+        0xc6, 0x7c, 0x00, 0x00, 0x18, 0x00, 0xfc, 0x66, 0x7c, 0x60, 0xf0,
+        0x00, 0x00, 0x0c, 0x18, 0xfc, 0x66, 0x7c, 0x6c, 0xe6, 0x00, 0x00,
+        0x28, 0x10, 0xfc, 0x66, 0x7c, 0x6c, 0xe6, 0x00, 0x00, 0xfc, 0x66,
+        0x66, 0x7c, 0x6c, 0xe6, 0x30, 0xe0, 0x00, 0x0c, 0x18, 0x7c, 0xc0,
+        0x78, 0x0c, 0xf8, 0x00, 0x00, 0x10, 0x28, 0x7c, 0xc0, 0x78, 0x0c,
+        0xf8, 0x00, 0x00, 0x18, 0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00,
+        0x00, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x30, 0x60, 0x00, 0x30,
+        0x00, 0xfc, 0xb4, 0x30, 0x30, 0x78, 0x00, 0x00, 0x50, 0x20, 0xfc,
+        0xb4, 0x30, 0x30, 0x78, 0x00, 0x00, 0xfc, 0xb4, 0x30, 0x30, 0x78,
+        0x00, 0x30, 0x60, 0x00, 0xfc, 0xb4, 0x30, 0x30, 0x30, 0x78, 0x0c,
+        0x78, 0x00, 0xfc, 0xb4, 0x30, 0x78, 0x30, 0x30, 0x78, 0x00, 0x00,
+        0x76, 0xdc, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x7c, 0x00,
+        0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0xc6, 0x7c, 0x00, 0xc6,
+        0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x38, 0x6c, 0x38, 0xc6, 0xc6, 0xc6,
+        0x7c, 0x00, 0x00, 0x33, 0x66, 0x00, 0xc6, 0xc6, 0xc6, 0x7c, 0x00,
+        0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x30, 0x1e, 0x00, 0x60,
+        0x30, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x0c, 0x18, 0xc6,
+        0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x10, 0x28, 0xc6, 0xd6, 0xd6,
+        0xfe, 0x6c, 0x00, 0x00, 0x6c, 0x00, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c,
+        0x00, 0x00, 0x60, 0x30, 0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00,
+        0x10, 0x28, 0xcc, 0xcc, 0x78, 0x30, 0x78, 0x00, 0x00, 0x18, 0x30,
+        0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00, 0x30, 0x00, 0xfc, 0x98,
+        0x30, 0x64, 0xfc, 0x00, 0x00, 0x7c, 0x00, 0x78, 0x0c, 0x7c, 0xcc,
+        0x76, 0x00, 0x00, 0xc6, 0x7c, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x00,
+        0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0x76, 0x0c, 0x07, 0x00, 0xec,
+        0x60, 0x60, 0x7c, 0x66, 0x66, 0xdc, 0x00, 0x00, 0x18, 0x30, 0x78,
+        0xcc, 0xc0, 0xcc, 0x78, 0x00, 0x00, 0x10, 0x28, 0x78, 0xcc, 0xc0,
+        0xcc, 0x78, 0x00, 0x00, 0x30, 0x00, 0x78, 0xcc, 0xc0, 0xcc, 0x78,
+        0x00, 0x00, 0x50, 0x20, 0x78, 0xcc, 0xc0, 0xcc, 0x78, 0x00, 0x00,
+        0x6c, 0x0c, 0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0xac, 0x4c,
+        0x0c, 0x7c, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x0c, 0x7e, 0x0c, 0x7c,
+        0xcc, 0xcc, 0x76, 0x00, 0x00, 0x78, 0x00, 0x78, 0xcc, 0xfc, 0xc0,
+        0x78, 0x00, 0x00, 0x30, 0x00, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00,
+        0x00, 0x50, 0x20, 0x78, 0xcc, 0xfc, 0xc0, 0x78, 0x00, 0x00, 0x78,
+        0xcc, 0xfc, 0xc0, 0x7c, 0x60, 0x3c, 0x00, 0x00, 0x33, 0x68, 0x60,
+        0xf0, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x10, 0x28, 0x76, 0xcc, 0xcc,
+        0x7c, 0x0c, 0xf8, 0x00, 0x18, 0x00, 0x76, 0xcc, 0xcc, 0x7c, 0x0c,
+        0xf8, 0x00, 0x1c, 0x30, 0x00, 0x76, 0xcc, 0x7c, 0x0c, 0xf8, 0x00,
+        0xe4, 0x6a, 0x60, 0x6c, 0x76, 0x66, 0xe6, 0x00, 0x00, 0x76, 0xdc,
+        0x00, 0x70, 0x30, 0x30, 0x78, 0x00, 0x00, 0xf8, 0x00, 0x70, 0x30,
+        0x30, 0x30, 0x78, 0x00, 0x00, 0x30, 0x00, 0x70, 0x30, 0x30, 0x78,
+        0x60, 0x3c, 0x00, 0x08, 0x14, 0x00, 0x1c, 0x0c, 0xcc, 0xcc, 0x78,
+        0x00, 0xe0, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x30, 0xe0, 0x00, 0xe6,
+        0x6c, 0x60, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x75, 0x32, 0x30,
+        0x30, 0x30, 0x30, 0x78, 0x00, 0x00, 0x70, 0x30, 0x30, 0x30, 0x30,
+        0x78, 0x18, 0xf0, 0x00, 0x70, 0x30, 0x30, 0x3c, 0xf0, 0x30, 0x78,
+        0x00, 0x00, 0x30, 0x00, 0xec, 0xfe, 0xd6, 0xd6, 0xd6, 0x00, 0x00,
+        0x0c, 0x18, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x00, 0x00, 0x28, 0x10,
+        0xdc, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66,
+        0x66, 0x66, 0x30, 0xe0, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66,
+        0x46, 0x1c, 0x00, 0x78, 0x00, 0x78, 0xcc, 0xcc, 0xcc, 0x78, 0x00,
+        0x00, 0x33, 0x66, 0x00, 0x78, 0xcc, 0xcc, 0x78, 0x00, 0x00, 0x18,
+        0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x0c, 0x18, 0x00,
+        0xdc, 0x76, 0x60, 0xf0, 0x00, 0x00, 0x28, 0x10, 0xdc, 0x76, 0x60,
+        0x60, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x60, 0xf0, 0x30,
+        0xe0, 0x00, 0x0c, 0x18, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00,
+        0x10, 0x28, 0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00, 0x30, 0x00,
+        0x7c, 0xc0, 0x78, 0x0c, 0xf8, 0x00, 0x00, 0x00, 0x7c, 0xc0, 0x78,
+        0x0c, 0xf8, 0x10, 0x30, 0x00, 0x16, 0x30, 0xfc, 0x30, 0x30, 0x36,
+        0x1c, 0x00, 0x00, 0x15, 0x32, 0xfc, 0x30, 0x30, 0x36, 0x1c, 0x00,
+        0x00, 0x10, 0x30, 0xfc, 0x30, 0x36, 0x1c, 0x10, 0x30, 0x00, 0x10,
+        0x30, 0xfc, 0x30, 0x36, 0x1c, 0x0c, 0x78, 0x00, 0x10, 0x30, 0xfc,
+        0x30, 0xfc, 0x30, 0x1c, 0x00, 0x00, 0x76, 0xdc, 0x00, 0xcc, 0xcc,
+        0xcc, 0x76, 0x00, 0x00, 0x78, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76,
+        0x00, 0x00, 0xc6, 0x7c, 0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00,
+        0x38, 0x6c, 0x38, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x33, 0x66,
+        0x00, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc,
+        0xcc, 0x76, 0x0c, 0x07, 0x00, 0x60, 0x30, 0xc6, 0xd6, 0xd6, 0xfe,
+        0x6c, 0x00, 0x00, 0x0c, 0x18, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00,
+        0x00, 0x10, 0x28, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x6c,
+        0x00, 0xc6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x60, 0x30, 0xcc,
+        0xcc, 0xcc, 0x7c, 0x0c, 0xf8, 0x00, 0x20, 0x50, 0x00, 0xcc, 0xcc,
+        0x7c, 0x0c, 0xf8, 0x00, 0x18, 0x30, 0xfc, 0x98, 0x30, 0x64, 0xfc,
+        0x00, 0x00, 0x30, 0x00, 0xfc, 0x98, 0x30, 0x64, 0xfc, 0x00, 0x00,
+        0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x30, 0x1e, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
+        0x60, 0x22, 0xff, 0xff, 0x64, 0x22, 0xff, 0xff, 0x65, 0x22, 0xff,
+        0xff, 0xa0, 0x25, 0xac, 0x25, 0xae, 0x25, 0xfc, 0x25, 0xfe, 0x25,
+        0x1b, 0x2b, 0x0e, 0x22, 0xff, 0xff, 0xc6, 0x25, 0x66, 0x26, 0x25,
+        0x2b, 0x27, 0x2b, 0xff, 0xff, 0xbc, 0x00, 0xff, 0xff, 0xbd, 0x00,
+        0xff, 0xff, 0xbe, 0x00, 0xff, 0xff, 0xa6, 0x00, 0xff, 0xff, 0xa8,
+        0x00, 0xff, 0xff, 0xb8, 0x00, 0xff, 0xff, 0x92, 0x01, 0xff, 0xff,
+        0x20, 0x20, 0xff, 0xff, 0x21, 0x20, 0xff, 0xff, 0x30, 0x20, 0xff,
+        0xff, 0x22, 0x21, 0xff, 0xff, 0x26, 0x20, 0xff, 0xff, 0x39, 0x20,
+        0xff, 0xff, 0x3a, 0x20, 0xff, 0xff, 0x1c, 0x20, 0x1f, 0x20, 0xff,
+        0xff, 0x1d, 0x20, 0xee, 0x02, 0xff, 0xff, 0x1e, 0x20, 0xff, 0xff,
+        0x42, 0x2e, 0xff, 0xff, 0x41, 0x2e, 0xce, 0x02, 0xff, 0xff, 0x1e,
+        0x01, 0xff, 0xff, 0x1f, 0x01, 0xff, 0xff, 0x30, 0x01, 0xff, 0xff,
+        0x31, 0x01, 0xff, 0xff, 0x5e, 0x01, 0xff, 0xff, 0x5f, 0x01, 0xff,
+        0xff, 0x20, 0x00, 0xa0, 0x00, 0x00, 0x20, 0x01, 0x20, 0x02, 0x20,
+        0x03, 0x20, 0x04, 0x20, 0x05, 0x20, 0x06, 0x20, 0x07, 0x20, 0x08,
+        0x20, 0x09, 0x20, 0x0a, 0x20, 0x2f, 0x20, 0x5f, 0x20, 0xff, 0xff,
+        0x21, 0x00, 0xff, 0xff, 0x22, 0x00, 0xff, 0xff, 0x23, 0x00, 0xff,
+        0xff, 0x24, 0x00, 0xff, 0xff, 0x25, 0x00, 0xff, 0xff, 0x26, 0x00,
+        0xff, 0xff, 0x27, 0x00, 0xbc, 0x02, 0xff, 0xff, 0x28, 0x00, 0xff,
+        0xff, 0x29, 0x00, 0xff, 0xff, 0x2a, 0x00, 0x4e, 0x20, 0x17, 0x22,
+        0xff, 0xff, 0x2b, 0x00, 0xff, 0xff, 0x2c, 0x00, 0xcf, 0x02, 0x75,
+        0x03, 0x1a, 0x20, 0xff, 0xff, 0x2d, 0x00, 0xad, 0x00, 0x10, 0x20,
+        0x11, 0x20, 0x12, 0x20, 0x13, 0x20, 0x43, 0x20, 0x12, 0x22, 0xff,
+        0xff, 0x2e, 0x00, 0x24, 0x20, 0xff, 0xff, 0x2f, 0x00, 0x44, 0x20,
+        0x15, 0x22, 0xff, 0xff, 0x30, 0x00, 0xff, 0xff, 0x31, 0x00, 0xff,
+        0xff, 0x32, 0x00, 0xff, 0xff, 0x33, 0x00, 0xff, 0xff, 0x34, 0x00,
+        0xff, 0xff, 0x35, 0x00, 0xff, 0xff, 0x36, 0x00, 0xff, 0xff, 0x37,
+        0x00, 0xff, 0xff, 0x38, 0x00, 0xff, 0xff, 0x39, 0x00, 0xff, 0xff,
+        0x3a, 0x00, 0x36, 0x22, 0xff, 0xff, 0x3b, 0x00, 0xff, 0xff, 0x3c,
+        0x00, 0xff, 0xff, 0x3d, 0x00, 0x40, 0x2e, 0xff, 0xff, 0x3e, 0x00,
+        0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0x40, 0x00, 0xff, 0xff, 0x41,
+        0x00, 0x10, 0x04, 0x91, 0x03, 0xff, 0xff, 0x42, 0x00, 0x12, 0x04,
+        0x92, 0x03, 0xff, 0xff, 0x43, 0x00, 0x21, 0x04, 0xf9, 0x03, 0xff,
+        0xff, 0x44, 0x00, 0xff, 0xff, 0x45, 0x00, 0x15, 0x04, 0x95, 0x03,
+        0xff, 0xff, 0x46, 0x00, 0xff, 0xff, 0x47, 0x00, 0xff, 0xff, 0x48,
+        0x00, 0x1d, 0x04, 0x97, 0x03, 0xff, 0xff, 0x49, 0x00, 0x06, 0x04,
+        0xc0, 0x04, 0xcf, 0x04, 0x99, 0x03, 0xff, 0xff, 0x4a, 0x00, 0x08,
+        0x04, 0x7f, 0x03, 0xff, 0xff, 0x4b, 0x00, 0x1a, 0x04, 0x9a, 0x03,
+        0x2a, 0x21, 0xff, 0xff, 0x4c, 0x00, 0xff, 0xff, 0x4d, 0x00, 0x1c,
+        0x04, 0x9c, 0x03, 0xfa, 0x03, 0xff, 0xff, 0x4e, 0x00, 0x9d, 0x03,
+        0xff, 0xff, 0x4f, 0x00, 0x1e, 0x04, 0x9f, 0x03, 0xff, 0xff, 0x50,
+        0x00, 0x20, 0x04, 0xa1, 0x03, 0xff, 0xff, 0x51, 0x00, 0x1a, 0x05,
+        0xff, 0xff, 0x52, 0x00, 0xff, 0xff, 0x53, 0x00, 0x05, 0x04, 0xff,
+        0xff, 0x54, 0x00, 0x22, 0x04, 0xa4, 0x03, 0xff, 0xff, 0x55, 0x00,
+        0xff, 0xff, 0x56, 0x00, 0xff, 0xff, 0x57, 0x00, 0x1c, 0x05, 0xff,
+        0xff, 0x58, 0x00, 0x25, 0x04, 0xa7, 0x03, 0xff, 0xff, 0x59, 0x00,
+        0xae, 0x04, 0xa5, 0x03, 0xff, 0xff, 0x5a, 0x00, 0x96, 0x03, 0xff,
+        0xff, 0x5b, 0x00, 0xff, 0xff, 0x5c, 0x00, 0xf5, 0x29, 0xff, 0xff,
+        0x5d, 0x00, 0xff, 0xff, 0x5e, 0x00, 0xc4, 0x02, 0xc6, 0x02, 0x03,
+        0x23, 0xff, 0xff, 0x5f, 0x00, 0xff, 0xff, 0x60, 0x00, 0xcb, 0x02,
+        0xef, 0x1f, 0x35, 0x20, 0xff, 0xff, 0x61, 0x00, 0x30, 0x04, 0xff,
+        0xff, 0x62, 0x00, 0xff, 0xff, 0x63, 0x00, 0x41, 0x04, 0xf2, 0x03,
+        0xff, 0xff, 0x64, 0x00, 0xff, 0xff, 0x65, 0x00, 0x35, 0x04, 0xff,
+        0xff, 0x66, 0x00, 0xff, 0xff, 0x67, 0x00, 0xff, 0xff, 0x68, 0x00,
+        0xff, 0xff, 0x69, 0x00, 0x56, 0x04, 0xff, 0xff, 0x6a, 0x00, 0x58,
+        0x04, 0xf3, 0x03, 0xff, 0xff, 0x6b, 0x00, 0xff, 0xff, 0x6c, 0x00,
+        0xff, 0xff, 0x6d, 0x00, 0xff, 0xff, 0x6e, 0x00, 0xff, 0xff, 0x6f,
+        0x00, 0x3e, 0x04, 0xbf, 0x03, 0xff, 0xff, 0x70, 0x00, 0x40, 0x04,
+        0xff, 0xff, 0x71, 0x00, 0x1b, 0x05, 0xff, 0xff, 0x72, 0x00, 0xff,
+        0xff, 0x73, 0x00, 0x55, 0x04, 0xff, 0xff, 0x74, 0x00, 0xff, 0xff,
+        0x75, 0x00, 0xff, 0xff, 0x76, 0x00, 0xff, 0xff, 0x77, 0x00, 0x1d,
+        0x05, 0xff, 0xff, 0x78, 0x00, 0x45, 0x04, 0xff, 0xff, 0x79, 0x00,
+        0x43, 0x04, 0xff, 0xff, 0x7a, 0x00, 0xff, 0xff, 0x7b, 0x00, 0xff,
+        0xff, 0x7c, 0x00, 0x23, 0x22, 0xff, 0xff, 0x7d, 0x00, 0xff, 0xff,
+        0x7e, 0x00, 0xdc, 0x02, 0xc0, 0x1f, 0xff, 0xff, 0x22, 0x20, 0x19,
+        0x22, 0xcf, 0x25, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xc1, 0x00,
+        0xff, 0xff, 0xc2, 0x00, 0xff, 0xff, 0xc3, 0x00, 0xff, 0xff, 0xc4,
+        0x00, 0xd2, 0x04, 0xff, 0xff, 0xc5, 0x00, 0x2b, 0x21, 0xff, 0xff,
+        0xc6, 0x00, 0xd4, 0x04, 0xff, 0xff, 0xc7, 0x00, 0xff, 0xff, 0xc8,
+        0x00, 0x00, 0x04, 0xff, 0xff, 0xc9, 0x00, 0xff, 0xff, 0xca, 0x00,
+        0xff, 0xff, 0xcb, 0x00, 0x01, 0x04, 0xff, 0xff, 0xcc, 0x00, 0xff,
+        0xff, 0xcd, 0x00, 0xff, 0xff, 0xce, 0x00, 0xff, 0xff, 0xcf, 0x00,
+        0x07, 0x04, 0xaa, 0x03, 0xff, 0xff, 0xd0, 0x00, 0x10, 0x01, 0xff,
+        0xff, 0xd1, 0x00, 0xff, 0xff, 0xd2, 0x00, 0xff, 0xff, 0xd3, 0x00,
+        0xff, 0xff, 0xd4, 0x00, 0xff, 0xff, 0xd5, 0x00, 0xff, 0xff, 0xd6,
+        0x00, 0xe6, 0x04, 0xff, 0xff, 0xd7, 0x00, 0xff, 0xff, 0xd8, 0x00,
+        0xff, 0xff, 0xd9, 0x00, 0xff, 0xff, 0xda, 0x00, 0xff, 0xff, 0xdb,
+        0x00, 0xff, 0xff, 0xdc, 0x00, 0xff, 0xff, 0xdd, 0x00, 0xff, 0xff,
+        0xde, 0x00, 0xf7, 0x03, 0xff, 0xff, 0xdf, 0x00, 0xff, 0xff, 0x92,
+        0x25, 0xff, 0xff, 0xa1, 0x00, 0xff, 0xff, 0xa2, 0x00, 0xff, 0xff,
+        0xa3, 0x00, 0xff, 0xff, 0xac, 0x20, 0xff, 0xff, 0xa5, 0x00, 0xff,
+        0xff, 0x60, 0x01, 0xff, 0xff, 0xa7, 0x00, 0xff, 0xff, 0x61, 0x01,
+        0xff, 0xff, 0xa9, 0x00, 0xff, 0xff, 0xaa, 0x00, 0xff, 0xff, 0xab,
+        0x00, 0xff, 0xff, 0xac, 0x00, 0xff, 0xff, 0xa4, 0x00, 0xff, 0xff,
+        0xae, 0x00, 0xff, 0xff, 0xaf, 0x00, 0xc9, 0x02, 0xff, 0xff, 0xb0,
+        0x00, 0xda, 0x02, 0xff, 0xff, 0xb1, 0x00, 0xff, 0xff, 0xb2, 0x00,
+        0xff, 0xff, 0xb3, 0x00, 0xff, 0xff, 0x7d, 0x01, 0xff, 0xff, 0xb5,
+        0x00, 0xbc, 0x03, 0xff, 0xff, 0xb6, 0x00, 0xff, 0xff, 0xb7, 0x00,
+        0x87, 0x03, 0x27, 0x20, 0xc5, 0x22, 0x31, 0x2e, 0xff, 0xff, 0x7e,
+        0x01, 0xff, 0xff, 0xb9, 0x00, 0xff, 0xff, 0xba, 0x00, 0xff, 0xff,
+        0xbb, 0x00, 0xff, 0xff, 0x52, 0x01, 0xff, 0xff, 0x53, 0x01, 0xff,
+        0xff, 0x78, 0x01, 0xab, 0x03, 0xff, 0xff, 0xbf, 0x00, 0xff, 0xff,
+        0x00, 0x25, 0x14, 0x20, 0x15, 0x20, 0xaf, 0x23, 0xff, 0xff, 0x02,
+        0x25, 0xff, 0xff, 0x0c, 0x25, 0x6d, 0x25, 0xff, 0xff, 0x10, 0x25,
+        0x6e, 0x25, 0xff, 0xff, 0x14, 0x25, 0x70, 0x25, 0xff, 0xff, 0x18,
+        0x25, 0x6f, 0x25, 0xff, 0xff, 0x1c, 0x25, 0xff, 0xff, 0x24, 0x25,
+        0xff, 0xff, 0x2c, 0x25, 0xff, 0xff, 0x34, 0x25, 0xff, 0xff, 0x3c,
+        0x25, 0xff, 0xff, 0x91, 0x25, 0xff, 0xff, 0xba, 0x23, 0x3e, 0x20,
+        0xff, 0xff, 0xbb, 0x23, 0xff, 0xff, 0xbc, 0x23, 0xff, 0xff, 0xbd,
+        0x23, 0xff, 0xff, 0x50, 0x25, 0x01, 0x25, 0xff, 0xff, 0x51, 0x25,
+        0x03, 0x25, 0xff, 0xff, 0x54, 0x25, 0x0f, 0x25, 0xff, 0xff, 0x57,
+        0x25, 0x13, 0x25, 0xff, 0xff, 0x5a, 0x25, 0x17, 0x25, 0xff, 0xff,
+        0x5d, 0x25, 0x1b, 0x25, 0xff, 0xff, 0x60, 0x25, 0x23, 0x25, 0xff,
+        0xff, 0x63, 0x25, 0x2b, 0x25, 0xff, 0xff, 0x66, 0x25, 0x33, 0x25,
+        0xff, 0xff, 0x69, 0x25, 0x3b, 0x25, 0xff, 0xff, 0x6c, 0x25, 0x4b,
+        0x25, 0xff, 0xff, 0x88, 0x25, 0xff, 0xff, 0x91, 0x21, 0xff, 0xff,
+        0x93, 0x21, 0xff, 0xff, 0x90, 0x21, 0xff, 0xff, 0x92, 0x21, 0xff,
+        0xff, 0xe0, 0x00, 0xff, 0xff, 0xe1, 0x00, 0xff, 0xff, 0xe2, 0x00,
+        0xff, 0xff, 0xe3, 0x00, 0xff, 0xff, 0xe4, 0x00, 0xd3, 0x04, 0xff,
+        0xff, 0xe5, 0x00, 0xff, 0xff, 0xe6, 0x00, 0xd5, 0x04, 0xff, 0xff,
+        0xe7, 0x00, 0xff, 0xff, 0xe8, 0x00, 0x50, 0x04, 0xff, 0xff, 0xe9,
+        0x00, 0xff, 0xff, 0xea, 0x00, 0xff, 0xff, 0xeb, 0x00, 0x51, 0x04,
+        0xff, 0xff, 0xec, 0x00, 0xff, 0xff, 0xed, 0x00, 0xff, 0xff, 0xee,
+        0x00, 0xff, 0xff, 0xef, 0x00, 0x57, 0x04, 0xff, 0xff, 0xf0, 0x00,
+        0xff, 0xff, 0xf1, 0x00, 0xff, 0xff, 0xf2, 0x00, 0xff, 0xff, 0xf3,
+        0x00, 0xff, 0xff, 0xf4, 0x00, 0xff, 0xff, 0xf5, 0x00, 0xff, 0xff,
+        0xf6, 0x00, 0xe7, 0x04, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xf8,
+        0x00, 0xff, 0xff, 0xf9, 0x00, 0xff, 0xff, 0xfa, 0x00, 0xff, 0xff,
+        0xfb, 0x00, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xfd, 0x00, 0xff,
+        0xff, 0xfe, 0x00, 0xf8, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+        0xb4, 0x00, 0xb9, 0x02, 0xca, 0x02, 0x74, 0x03, 0xfd, 0x1f, 0x32,
+        0x20, 0xff, 0xff, 0xbb, 0x02, 0xbd, 0x02, 0xfe, 0x1f, 0x18, 0x20,
+        0x1b, 0x20, 0xff, 0xff, 0x19, 0x20, 0xbd, 0x1f, 0xbf, 0x1f, 0xff,
+        0xff, 0x36, 0x20, 0xff, 0xff, 0x33, 0x20, 0xba, 0x02, 0xdd, 0x02,
+        0xff, 0xff, 0x16, 0x21, 0xff, 0xff, 0xb4, 0x20, 0xff, 0xff, 0xbd,
+        0x20, 0xff, 0xff, 0x11, 0x04, 0x82, 0x01, 0xff, 0xff, 0x13, 0x04,
+        0x93, 0x03, 0xff, 0xff, 0x14, 0x04, 0xff, 0xff, 0x16, 0x04, 0xff,
+        0xff, 0x17, 0x04, 0xff, 0xff, 0x18, 0x04, 0x76, 0x03, 0xff, 0xff,
+        0x19, 0x04, 0xff, 0xff, 0x1b, 0x04, 0xff, 0xff, 0x1f, 0x04, 0xa0,
+        0x03, 0x0f, 0x22, 0xff, 0xff, 0x23, 0x04, 0xff, 0xff, 0x24, 0x04,
+        0xa6, 0x03, 0xff, 0xff, 0x26, 0x04, 0xff, 0xff, 0x27, 0x04, 0xff,
+        0xff, 0x28, 0x04, 0xff, 0xff, 0x29, 0x04, 0xff, 0xff, 0x2a, 0x04,
+        0xff, 0xff, 0x2b, 0x04, 0xff, 0xff, 0x2c, 0x04, 0xff, 0xff, 0x2d,
+        0x04, 0xff, 0xff, 0x2e, 0x04, 0xff, 0xff, 0x2f, 0x04, 0xff, 0xff,
+        0x04, 0x04, 0xff, 0xff, 0x0e, 0x04, 0xff, 0xff, 0x02, 0x04, 0xff,
+        0xff, 0x03, 0x04, 0xff, 0xff, 0x09, 0x04, 0xff, 0xff, 0x0a, 0x04,
+        0xff, 0xff, 0x0b, 0x04, 0xff, 0xff, 0x0c, 0x04, 0x30, 0x1e, 0xff,
+        0xff, 0x0f, 0x04, 0xff, 0xff, 0x90, 0x04, 0xff, 0xff, 0x0d, 0x04,
+        0xff, 0xff, 0x31, 0x04, 0xff, 0xff, 0x32, 0x04, 0xff, 0xff, 0x33,
+        0x04, 0xff, 0xff, 0x34, 0x04, 0xff, 0xff, 0x36, 0x04, 0xff, 0xff,
+        0x37, 0x04, 0xff, 0xff, 0x38, 0x04, 0x77, 0x03, 0xff, 0xff, 0x39,
+        0x04, 0xff, 0xff, 0x3a, 0x04, 0xff, 0xff, 0x3b, 0x04, 0xff, 0xff,
+        0x3c, 0x04, 0xff, 0xff, 0x3d, 0x04, 0xff, 0xff, 0x3f, 0x04, 0xff,
+        0xff, 0x42, 0x04, 0xff, 0xff, 0x44, 0x04, 0xd5, 0x03, 0x78, 0x02,
+        0xff, 0xff, 0x46, 0x04, 0xff, 0xff, 0x47, 0x04, 0xff, 0xff, 0x48,
+        0x04, 0xff, 0xff, 0x49, 0x04, 0xff, 0xff, 0x4a, 0x04, 0xff, 0xff,
+        0x4b, 0x04, 0xff, 0xff, 0x4c, 0x04, 0xff, 0xff, 0x4d, 0x04, 0xf6,
+        0x03, 0xff, 0xff, 0x4e, 0x04, 0xff, 0xff, 0x4f, 0x04, 0xff, 0xff,
+        0x54, 0x04, 0xf5, 0x03, 0xff, 0xff, 0x5e, 0x04, 0xff, 0xff, 0x52,
+        0x04, 0xff, 0xff, 0x53, 0x04, 0xff, 0xff, 0x59, 0x04, 0xff, 0xff,
+        0x5a, 0x04, 0xff, 0xff, 0x5b, 0x04, 0x27, 0x01, 0xff, 0xff, 0x5c,
+        0x04, 0xff, 0xff, 0x5f, 0x04, 0xff, 0xff, 0x91, 0x04, 0xff, 0xff,
+        0x5d, 0x04, 0xff, 0xff, 0x7a, 0x03, 0xbe, 0x1f, 0xff, 0xff, 0x84,
+        0x03, 0xff, 0xff, 0x85, 0x03, 0xff, 0xff, 0x86, 0x03, 0xff, 0xff,
+        0x88, 0x03, 0xff, 0xff, 0x89, 0x03, 0xff, 0xff, 0x8a, 0x03, 0xff,
+        0xff, 0x8c, 0x03, 0xff, 0xff, 0x8e, 0x03, 0xff, 0xff, 0x8f, 0x03,
+        0xff, 0xff, 0x90, 0x03, 0xff, 0xff, 0x94, 0x03, 0x06, 0x22, 0xff,
+        0xff, 0x98, 0x03, 0x9f, 0x01, 0xf4, 0x03, 0x72, 0x04, 0xe8, 0x04,
+        0xff, 0xff, 0x9b, 0x03, 0x45, 0x02, 0xff, 0xff, 0x9e, 0x03, 0xff,
+        0xff, 0xa3, 0x03, 0xa9, 0x01, 0x11, 0x22, 0xff, 0xff, 0xa8, 0x03,
+        0xff, 0xff, 0xa9, 0x03, 0x26, 0x21, 0xff, 0xff, 0xac, 0x03, 0xff,
+        0xff, 0xad, 0x03, 0xff, 0xff, 0xae, 0x03, 0xff, 0xff, 0xaf, 0x03,
+        0xff, 0xff, 0xb0, 0x03, 0xff, 0xff, 0xb1, 0x03, 0xff, 0xff, 0xb2,
+        0x03, 0xff, 0xff, 0xb3, 0x03, 0xff, 0xff, 0xb4, 0x03, 0x9f, 0x1e,
+        0xff, 0xff, 0xb5, 0x03, 0x5b, 0x02, 0xff, 0xff, 0xb6, 0x03, 0xff,
+        0xff, 0xb7, 0x03, 0x9e, 0x01, 0xff, 0xff, 0xb8, 0x03, 0xff, 0xff,
+        0xb9, 0x03, 0x69, 0x02, 0xff, 0xff, 0xba, 0x03, 0x38, 0x01, 0xff,
+        0xff, 0xbb, 0x03, 0xff, 0xff, 0xbd, 0x03, 0xff, 0xff, 0xbe, 0x03,
+        0xff, 0xff, 0xc1, 0x03, 0xff, 0xff, 0xc2, 0x03, 0xff, 0xff, 0xc3,
+        0x03, 0xff, 0xff, 0xc4, 0x03, 0xff, 0xff, 0xc5, 0x03, 0xff, 0xff,
+        0xc6, 0x03, 0xff, 0xff, 0xc7, 0x03, 0xff, 0xff, 0xc8, 0x03, 0xff,
+        0xff, 0xc9, 0x03, 0xff, 0xff, 0xca, 0x03, 0xff, 0xff, 0xcb, 0x03,
+        0xff, 0xff, 0xcc, 0x03, 0xff, 0xff, 0xcd, 0x03, 0xff, 0xff, 0xce,
+        0x03, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0x02, 0x01, 0xd0, 0x04,
+        0xff, 0xff, 0x04, 0x01, 0xff, 0xff, 0x02, 0x1e, 0xff, 0xff, 0x06,
+        0x01, 0xff, 0xff, 0x08, 0x01, 0xff, 0xff, 0x0a, 0x01, 0xff, 0xff,
+        0x0c, 0x01, 0xff, 0xff, 0x0a, 0x1e, 0xff, 0xff, 0x0e, 0x01, 0xff,
+        0xff, 0x12, 0x01, 0xff, 0xff, 0x16, 0x01, 0xff, 0xff, 0x1a, 0x01,
+        0xff, 0xff, 0x18, 0x01, 0xff, 0xff, 0x1e, 0x1e, 0xff, 0xff, 0x1c,
+        0x01, 0xff, 0xff, 0x20, 0x01, 0xff, 0xff, 0x22, 0x01, 0xff, 0xff,
+        0x24, 0x01, 0xff, 0xff, 0x26, 0x01, 0xff, 0xff, 0x28, 0x01, 0xff,
+        0xff, 0x2a, 0x01, 0xff, 0xff, 0x2e, 0x01, 0xff, 0xff, 0x34, 0x01,
+        0xff, 0xff, 0x36, 0x01, 0xff, 0xff, 0x39, 0x01, 0xff, 0xff, 0x3d,
+        0x01, 0xff, 0xff, 0x3b, 0x01, 0xff, 0xff, 0x41, 0x01, 0xff, 0xff,
+        0x40, 0x1e, 0xff, 0xff, 0x43, 0x01, 0xff, 0xff, 0x47, 0x01, 0xff,
+        0xff, 0x45, 0x01, 0xff, 0xff, 0x4a, 0x01, 0xff, 0xff, 0x4c, 0x01,
+        0xff, 0xff, 0x50, 0x01, 0xff, 0xff, 0x56, 0x1e, 0xff, 0xff, 0x54,
+        0x01, 0xff, 0xff, 0x58, 0x01, 0xff, 0xff, 0x56, 0x01, 0xff, 0xff,
+        0x5a, 0x01, 0xff, 0xff, 0x5c, 0x01, 0xff, 0xff, 0x60, 0x1e, 0xff,
+        0xff, 0x18, 0x02, 0xff, 0xff, 0x6a, 0x1e, 0xff, 0xff, 0x64, 0x01,
+        0xff, 0xff, 0x1a, 0x02, 0xff, 0xff, 0x62, 0x01, 0xff, 0xff, 0x66,
+        0x01, 0xff, 0xff, 0x68, 0x01, 0xff, 0xff, 0x6a, 0x01, 0xff, 0xff,
+        0x6c, 0x01, 0xff, 0xff, 0x6e, 0x01, 0xff, 0xff, 0x70, 0x01, 0xff,
+        0xff, 0x72, 0x01, 0xff, 0xff, 0x80, 0x1e, 0xff, 0xff, 0x82, 0x1e,
+        0xff, 0xff, 0x74, 0x01, 0xff, 0xff, 0x84, 0x1e, 0xff, 0xff, 0xf2,
+        0x1e, 0xff, 0xff, 0x76, 0x01, 0xff, 0xff, 0x79, 0x01, 0xff, 0xff,
+        0x7b, 0x01, 0xff, 0xff, 0x01, 0x01, 0xff, 0xff, 0x03, 0x01, 0xd1,
+        0x04, 0xff, 0xff, 0x05, 0x01, 0xff, 0xff, 0x03, 0x1e, 0xff, 0xff,
+        0x07, 0x01, 0xff, 0xff, 0x09, 0x01, 0xff, 0xff, 0x0b, 0x01, 0xff,
+        0xff, 0x0d, 0x01, 0xff, 0xff, 0x0b, 0x1e, 0xff, 0xff, 0x0f, 0x01,
+        0xff, 0xff, 0x11, 0x01, 0xff, 0xff, 0x13, 0x01, 0xff, 0xff, 0x17,
+        0x01, 0xff, 0xff, 0x1b, 0x01, 0xff, 0xff, 0x19, 0x01, 0xff, 0xff,
+        0x1f, 0x1e, 0xff, 0xff, 0x1d, 0x01, 0xff, 0xff, 0x21, 0x01, 0xff,
+        0xff, 0x23, 0x01, 0xff, 0xff, 0x25, 0x01, 0xff, 0xff, 0x29, 0x01,
+        0xff, 0xff, 0x2b, 0x01, 0xff, 0xff, 0x2f, 0x01, 0xff, 0xff, 0x35,
+        0x01, 0xff, 0xff, 0x37, 0x01, 0xff, 0xff, 0x3a, 0x01, 0xff, 0xff,
+        0x3e, 0x01, 0xff, 0xff, 0x3c, 0x01, 0xff, 0xff, 0x42, 0x01, 0xff,
+        0xff, 0x41, 0x1e, 0xff, 0xff, 0x44, 0x01, 0xff, 0xff, 0x48, 0x01,
+        0xff, 0xff, 0x46, 0x01, 0xff, 0xff, 0x4b, 0x01, 0xff, 0xff, 0x4d,
+        0x01, 0xff, 0xff, 0x51, 0x01, 0xff, 0xff, 0x57, 0x1e, 0xff, 0xff,
+        0x55, 0x01, 0xff, 0xff, 0x59, 0x01, 0xff, 0xff, 0x57, 0x01, 0xff,
+        0xff, 0x5b, 0x01, 0xff, 0xff, 0x5d, 0x01, 0xff, 0xff, 0x61, 0x1e,
+        0xff, 0xff, 0x19, 0x02, 0xff, 0xff, 0x6b, 0x1e, 0xff, 0xff, 0x65,
+        0x01, 0xff, 0xff, 0x1b, 0x02, 0xff, 0xff, 0x63, 0x01, 0xff, 0xff,
+        0x67, 0x01, 0xff, 0xff, 0x69, 0x01, 0xff, 0xff, 0x6b, 0x01, 0xff,
+        0xff, 0x6d, 0x01, 0xff, 0xff, 0x6f, 0x01, 0xff, 0xff, 0x71, 0x01,
+        0xff, 0xff, 0x73, 0x01, 0xff, 0xff, 0x81, 0x1e, 0xff, 0xff, 0x83,
+        0x1e, 0xff, 0xff, 0x75, 0x01, 0xff, 0xff, 0x85, 0x1e, 0xff, 0xff,
+        0xf3, 0x1e, 0xff, 0xff, 0x77, 0x01, 0xff, 0xff, 0x7a, 0x01, 0xff,
+        0xff, 0x7c, 0x01, 0xff, 0xff, 0xd8, 0x02, 0xff, 0xff, 0xd9, 0x02,
+        0xff, 0xff, 0xc7, 0x02, 0xff, 0xff, 0xdb, 0x02, 0xff, 0xff};
+
+struct psf_font psf_default = {
+        .glyphs      = psf_default_font + sizeof(psf1_header_t),
+        .count       = 512,
+        .width       = 8,
+        .height      = 9,
+        .row_bytes   = PSF1_WIDTH,
+        .glyph_bytes = 9,
+        .table       = psf_default_font + sizeof(psf1_header_t) + 512 * 9,
+        .table_end   = psf_default_font + sizeof(psf_default_font),
+};
+
+/* Built the first time the default font is drawn with */
+static struct psf_unimap psf_default_map;
+
+/* Expanded glyphs for one fg/bg pair. A glyph is expanded the first time it
+ * is drawn in the pair and marked in ready. */
+#define PSF_GLYPHS_MAX 512
+
+struct psf_variant {
+    uint32_t fg, bg;
+    uint32_t used; /* Tick of the last draw, 0 if the variant is free */
+    uint8_t *pixels;
+    uint8_t  ready[PSF_GLYPHS_MAX / 8];
+};
+
+/* The arena is split between as many colour pairs as fit, up to
+ * PSF_VARIANTS, with the least recently drawn pair making way for a new
+ * one. 512 KiB holds three pairs of the built-in font at 32 bpp. */
+#define PSF_ARENA_BYTES (512 * 1024)
+#define PSF_VARIANTS    8
+
+static uint8_t psf_arena[PSF_ARENA_BYTES] __attribute__((__aligned__(64)));
+
+static struct {
+    struct fb             *fb;
+    const struct psf_font *font;
+    size_t                 glyph_bytes; /* One glyph, expanded */
+    size_t                 row_bytes;   /* One row of a glyph, expanded */
+    unsigned               variants;
+    uint32_t               tick;
+    struct psf_variant    *last;
+    struct psf_variant     variant[PSF_VARIANTS];
+} psf_cache;
+
+static uint32_t psf_fg = 0xFFFFFFFF, psf_bg;
+static uint32_t psf_col, psf_row;
+
+int psf_load(struct psf_font *font, const void *data, size_t len)
+{
+    const psf1_header_t *h1 = data;
+    const psf2_header_t *h2 = data;
+    size_t               glyphs_at, glyphs_len;
+
+    if (len >= sizeof(*h2) && h2->magic == PSF2_MAGIC) {
+        font->count       = h2->length;
+        font->width       = h2->width;
+        font->height      = h2->height;
+        font->row_bytes   = (h2->width + 7) / 8;
+        font->glyph_bytes = h2->glyph_size;
+        font->table_utf8  = 1;
+        glyphs_at         = h2->header_size;
+        if (font->glyph_bytes < font->row_bytes * font->height)
+            return -1;
+    } else if (len >= sizeof(*h1) && h1->magic == PSF1_MAGIC &&
+               h1->glyph_size) {
+        font->count       = (h1->font_mode & PSF1_MODE512) ? 512 : 256;
+        font->width       = 8;
+        font->height      = h1->glyph_size;
+        font->row_bytes   = PSF1_WIDTH;
+        font->glyph_bytes = h1->glyph_size;
+        font->table_utf8  = 0;
+        glyphs_at         = sizeof(*h1);
+    } else
+        return -1;
+
+    glyphs_len = ( size_t )font->count * font->glyph_bytes;
+    if (!font->count || glyphs_at > len || len - glyphs_at < glyphs_len)
+        return -1;
+
+    font->glyphs    = ( const uint8_t * )data + glyphs_at;
+    font->table     = NULL;
+    font->table_end = NULL;
+    font->map       = NULL;
+    if (font->table_utf8 ? (h2->flags & PSF2_HAS_UNICODE_TABLE)
+                         : (h1->font_mode & PSF1_MODEHASTAB)) {
+        font->table     = font->glyphs + glyphs_len;
+        font->table_end = ( const uint8_t * )data + len;
+    }
+    return 0;
+}
+
+/* Decode one UTF-8 sequence at *s, no further than end, and step past it.
+ * Malformed input comes out as U+FFFD a byte at a time. */
+static uint32_t utf8_next(const uint8_t **s, const uint8_t *end)
+{
+    const uint8_t *p = *s;
+    uint32_t       cp, min;
+    int            more;
+
+    if (p[0] < 0x80) {
+        *s = p + 1;
+        return p[0];
+    }
+    if ((p[0] & 0xE0) == 0xC0) {
+        cp = p[0] & 0x1F, more = 1, min = 0x80;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        cp = p[0] & 0x0F, more = 2, min = 0x800;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        cp = p[0] & 0x07, more = 3, min = 0x10000;
+    } else {
+        *s = p + 1;
+        return 0xFFFD;
+    }
+
+    if (end - p <= more) {
+        *s = p + 1;
+        return 0xFFFD;
+    }
+    for (int i = 1; i <= more; ++i) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *s = p + 1;
+            return 0xFFFD;
+        }
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+    *s = p + more + 1;
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        return 0xFFFD;
+    return cp;
+}
+
+static unsigned psf_astral_hash(uint32_t cp)
+{
+    return (cp * 2654435761u) >> 24; /* Top 8 bits, PSF_ASTRAL_SLOTS */
+}
+
+static void psf_map_add(struct psf_unimap *map, uint32_t cp, uint16_t glyph)
+{
+    if (cp < 0x10000) {
+        if (map->bmp[cp] == PSF_NO_GLYPH)
+            map->bmp[cp] = glyph;
+        return;
+    }
+
+    /* Codepoints beyond the table are left unmapped */
+    for (unsigned i = 0, h = psf_astral_hash(cp); i < PSF_ASTRAL_SLOTS;
+         ++i, h = (h + 1) % PSF_ASTRAL_SLOTS) {
+        if (map->astral[h].glyph == PSF_NO_GLYPH) {
+            map->astral[h].cp    = cp;
+            map->astral[h].glyph = glyph;
+            return;
+        }
+        if (map->astral[h].cp == cp)
+            return;
+    }
+}
+
+/* Walk the Unicode table once, each glyph's entry being the codepoints it
+ * stands for up to the terminator, with sequences after the start marker
+ * skipped as they need more than one codepoint to match */
+int psf_map(struct psf_font *font, struct psf_unimap *map)
+{
+    const uint8_t *p = font->table, *end = font->table_end;
+    uint32_t       glyph = 0;
+    int            seq   = 0;
+
+    if (!p)
+        return -1;
+
+    memset(map, 0xFF, sizeof(*map));
+    while (p < end && glyph < font->count) {
+        uint32_t cp;
+
+        if (font->table_utf8) {
+            if (*p == PSF2_TABLE_TERM || *p == PSF2_TABLE_SEQ) {
+                cp = *p++ == PSF2_TABLE_TERM ? PSF1_TABLE_TERM
+                                             : PSF1_TABLE_SEQ;
+            } else
+                cp = utf8_next(&p, end);
+        } else {
+            if (end - p < 2)
+                break;
+            cp  = p[0] | ( uint32_t )p[1] << 8;
+            p  += 2;
+        }
+
+        if (cp == PSF1_TABLE_TERM) {
+            ++glyph;
+            seq = 0;
+        } else if (cp == PSF1_TABLE_SEQ)
+            seq = 1;
+        else if (!seq)
+            psf_map_add(map, cp, ( uint16_t )glyph);
+    }
+
+    map->fallback = map->bmp[0xFFFD];
+    if (map->fallback == PSF_NO_GLYPH)
+        map->fallback = map->bmp['?'];
+    if (map->fallback == PSF_NO_GLYPH)
+        map->fallback = 0;
+
+    font->map = map;
+    return 0;
+}
+
+uint32_t psf_lookup(const struct psf_font *font, uint32_t cp)
+{
+    const struct psf_unimap *map = font->map;
+    uint16_t                 glyph;
+
+    if (!map)
+        return cp < font->count ? cp : 0;
+
+    if (cp < 0x10000) {
+        glyph = map->bmp[cp];
+        return glyph == PSF_NO_GLYPH ? map->fallback : glyph;
+    }
+    for (unsigned i = 0, h = psf_astral_hash(cp); i < PSF_ASTRAL_SLOTS;
+         ++i, h = (h + 1) % PSF_ASTRAL_SLOTS) {
+        if (map->astral[h].glyph == PSF_NO_GLYPH)
+            break;
+        if (map->astral[h].cp == cp)
+            return map->astral[h].glyph;
+    }
+    return map->fallback;
+}
+
+int psf_init(struct fb *fb, const struct psf_font *font)
+{
+    size_t variant_bytes;
+
+    if (font == &psf_default && !psf_default.map)
+        psf_map(&psf_default, &psf_default_map);
+
+    psf_cache.fb          = fb;
+    psf_cache.font        = font;
+    psf_cache.row_bytes   = ( size_t )font->width * fb->bytes;
+    psf_cache.glyph_bytes = psf_cache.row_bytes * font->height;
+    psf_cache.tick        = 0;
+    psf_cache.last        = NULL;
+
+    variant_bytes = psf_cache.glyph_bytes * font->count;
+    if (font->count > PSF_GLYPHS_MAX || variant_bytes > PSF_ARENA_BYTES) {
+        psf_cache.variants = 0;
+        return -1;
+    }
+    psf_cache.variants = PSF_ARENA_BYTES / variant_bytes;
+    if (psf_cache.variants > PSF_VARIANTS)
+        psf_cache.variants = PSF_VARIANTS;
+    for (unsigned i = 0; i < psf_cache.variants; ++i) {
+        psf_cache.variant[i].used   = 0;
+        psf_cache.variant[i].pixels = psf_arena + i * variant_bytes;
+    }
+
+    psf_col = psf_row = 0;
+    return 0;
+}
+
+void psf_setcolour(uint32_t fg, uint32_t bg)
+{
+    psf_fg = fg;
+    psf_bg = bg;
+}
+
+/* The variant for the current colours, taking over the least recently
+ * drawn one if no variant has them yet */
+static struct psf_variant *psf_variant(void)
+{
+    struct psf_variant *v = psf_cache.last, *lru;
+
+    if (v && v->fg == psf_fg && v->bg == psf_bg)
+        return v;
+
+    lru = &psf_cache.variant[0];
+    for (unsigned i = 0; i < psf_cache.variants; ++i) {
+        v = &psf_cache.variant[i];
+        if (v->used && v->fg == psf_fg && v->bg == psf_bg)
+            return psf_cache.last = v;
+        if (v->used < lru->used)
+            lru = v;
+    }
+
+    lru->fg = psf_fg;
+    lru->bg = psf_bg;
+    memset(lru->ready, 0, sizeof(lru->ready));
+    return psf_cache.last = lru;
+}
+
+static void psf_expand(uint8_t *dst, uint32_t glyph)
+{
+    const struct psf_font *font  = psf_cache.font;
+    const struct fb_ops   *ops   = psf_cache.fb->ops;
+    const uint8_t         *bits  = font->glyphs + glyph * font->glyph_bytes;
+    uint8_t                bytes = psf_cache.fb->bytes;
+
+    for (uint32_t y = 0; y < font->height; ++y, bits += font->row_bytes)
+        for (uint32_t x = 0; x < font->width; ++x, dst += bytes)
+            ops->put(dst,
+                     (bits[x / 8] & (0x80 >> (x % 8))) ? psf_fg : psf_bg);
+}
+
+void psf_putglyph(uint32_t col, uint32_t row, uint32_t glyph)
+{
+    const struct psf_font *font = psf_cache.font;
+    struct fb             *fb   = psf_cache.fb;
+    struct psf_variant    *v;
+    const uint8_t         *src;
+    uint8_t               *dst;
+    uint32_t               x, y;
+
+    if (!psf_cache.variants)
+        return;
+    x = col * font->width;
+    y = row * font->height;
+    if (x + font->width > fb->width || y + font->height > fb->height)
+        return;
+    if (glyph >= font->count)
+        glyph = 0;
+
+    v = psf_variant();
+    v->used = ++psf_cache.tick;
+    src     = v->pixels + glyph * psf_cache.glyph_bytes;
+    if (!(v->ready[glyph / 8] & (1 << (glyph % 8)))) {
+        psf_expand(( uint8_t * )src, glyph);
+        v->ready[glyph / 8] |= ( uint8_t )(1 << (glyph % 8));
+    }
+
+    dst = fb->base + ( size_t )y * fb->pitch + ( size_t )x * fb->bytes;
+    for (uint32_t i = 0; i < font->height; ++i) {
+        memcpy(dst, src, psf_cache.row_bytes);
+        dst += fb->pitch;
+        src += psf_cache.row_bytes;
+    }
+    fb_damage(fb, x, y, font->width, font->height);
+}
+
+/* Move the screen up a text row and clear the row uncovered */
+static void psf_scroll(void)
+{
+    struct fb *fb     = psf_cache.fb;
+    uint32_t   height = psf_cache.font->height;
+    uint32_t   rows   = fb->height / height;
+    size_t     row    = ( size_t )height * fb->pitch;
+
+    memmove(fb->base, fb->base + row, (rows - 1) * row);
+    fb_fill(fb, 0, (rows - 1) * height, fb->width, height, psf_bg);
+    fb_damage(fb, 0, 0, fb->width, rows * height);
+}
+
+int pfs_puts(const char *str)
+{
+    const uint8_t *s   = ( const uint8_t * )str;
+    const uint8_t *end = s + strlen(str);
+    uint32_t       cols, rows;
+    int            n = 0;
+
+    if (!psf_cache.variants)
+        return 0;
+    cols = psf_cache.fb->width / psf_cache.font->width;
+    rows = psf_cache.fb->height / psf_cache.font->height;
+
+    for (; s < end; ++n) {
+        uint32_t cp = utf8_next(&s, end);
+
+        if (cp != '\n') {
+            psf_putglyph(psf_col, psf_row, psf_lookup(psf_cache.font, cp));
+            if (++psf_col < cols)
+                continue;
+        }
+        psf_col = 0;
+        if (++psf_row == rows) {
+            psf_scroll();
+            --psf_row;
+        }
+    }
+    return n;
+}
 
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
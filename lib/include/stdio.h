@@ -32,6 +32,8 @@
 #define _STDIO_H
 
 #include <sys/cdefs.h>
+#include <stdarg.h>
+#include <stddef.h>
 
 #define EOF (-1)
 
@@ -39,7 +41,14 @@
 extern "C" {
 #endif
 
-int printf(const char *restrict, ...);
+/* Beyond C: %b prints binary and a bare %l means %ld. The compiler's format
+ * checks do not know either, use kprint() or %lu/%lx in new code. */
+int printf(const char *restrict, ...) __printflike(1, 2);
+int vprintf(const char *restrict, va_list) __printflike(1, 0);
+int snprintf(char *restrict, size_t, const char *restrict, ...)
+        __printflike(3, 4);
+int vsnprintf(char *restrict, size_t, const char *restrict, va_list)
+        __printflike(3, 0);
 int putchar(int);
 int puts(const char *);
 
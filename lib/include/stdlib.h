@@ -70,6 +70,8 @@ ldiv_t ldiv(long n, long d);
 
 char *itoa(int n, char *str, int base);
 char *ltoa(long n, char *str, int base);
+char *utoa(unsigned int n, char *str, int base);
+char *ultoa(unsigned long n, char *str, int base);
 
 void reverse(char *str, size_t len);
 
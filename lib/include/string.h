@@ -38,14 +38,27 @@
 extern "C" {
 #endif
 
+#ifndef NULL
+#define NULL (( void * )0)
+#endif /* NULL */
+
+void *memchr(const void *mem, int val, size_t size);
 int   memcmp(const void *dest, const void *src, size_t size);
 int   memvacmp(const void *mem, unsigned char val, size_t size);
 void *memcpy(void *dest, const void *src, size_t size);
 void *memmove(void *dest, const void *src, size_t size);
 void *memset(void *mem, int val, size_t size);
 
+/* Non-temporal variants for large buffers that should not displace the
+ * cache, such as framebuffers and pages being cleared */
+void *memcpy_nt(void *dest, const void *src, size_t size);
+void *memset_nt(void *mem, int val, size_t size);
+
 size_t strlen(const char *);
+size_t strnlen(const char *str, size_t maxlen);
+char  *strchr(const char *str, int val);
 char  *strcpy(char *dest, const char *src);
+char  *stpcpy(char *dest, const char *src);
 
 #ifdef __cplusplus
 }
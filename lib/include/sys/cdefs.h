@@ -136,6 +136,10 @@
 #define __alloc_size2(n, x) __attribute__((__alloc_size__(n, x)))
 #define __alloc_align(x)    __attribute__((__alloc_align__(x)))
 
+/* Have the compiler check arguments against a printf style format */
+#define __printflike(fmtarg, firstvararg)                                      \
+    __attribute__((__format__(__printf__, fmtarg, firstvararg)))
+
 #endif /* _SYS_CDEFS_H */
 
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,91 @@
+/* console.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SYS_CONSOLE_H
+#define _SYS_CONSOLE_H
+
+#include <sys/cdefs.h>
+#include <sys/klog.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Console devices. Every backend, the VGA text screen, a serial line, the
+ * QEMU debug port, registers a struct console with a bulk write callback.
+ * console_drain() brings each enabled console up to date with the kernel log
+ * through the console's own klog reader, so every console is fed from its own
+ * queue and a slow one never throttles a fast one. console_write() is the
+ * unlogged path behind putchar() and puts().
+ *
+ * "console=name,name" on the kernel command line enables only the consoles
+ * named, e.g. "console=debugcon" to log to nothing but the debug port. */
+
+struct console {
+    const char *name;
+    void (*write)(const char *data, size_t size);
+    void (*panic)(void); /* Optional, called once before a panic dump */
+
+    /* Owned by the console layer */
+    unsigned           flags;
+    struct klog_reader log;
+    struct console    *next;
+};
+
+#define CONSOLE_ENABLED (1u << 0)
+
+/* Add `con` to the consoles, it starts with the oldest record still logged */
+void console_register(struct console *con);
+
+/* Enable only the consoles named in the comma separated list `names`, both
+ * those registered so far and any registered later. An empty list enables
+ * every console. */
+void console_select(const char *names, size_t len);
+
+/* console_select() with the value of a "console=" word, if there is one */
+void console_parse_cmdline(const char *cmdline);
+
+/* Write straight to every enabled console, bypassing the log */
+void console_write(const char *data, size_t size);
+
+/* Drain the log to every enabled console */
+void console_drain(void);
+
+/* Drain for the panic path, see klog_dump() */
+void console_dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYS_CONSOLE_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
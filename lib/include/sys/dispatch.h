@@ -0,0 +1,116 @@
+/* dispatch.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SYS_DISPATCH_H
+#define _SYS_DISPATCH_H
+
+#include <sys/cdefs.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The hot libk routines are called through this table so the kernel can bind
+ * them to the best implementation for the CPU once its features are known.
+ * Until libk_dispatch() runs every entry points at the SSE2 baseline that
+ * any x86_64 part can execute. New accelerated routines (checksums, ...)
+ * get an entry here and a case in libk_dispatch(). */
+struct libk_ops {
+    void  *(*memcpy)(void *dest, const void *src, size_t size);
+    void  *(*memset)(void *mem, int val, size_t size);
+    int    (*memcmp)(const void *dest, const void *src, size_t size);
+    size_t (*strlen)(const char *str);
+
+    /* Pixel row kernels behind <sys/gfx.h>, counts are in pixels */
+    void (*gfx_fill32)(uint32_t *dst, uint32_t pixel, size_t n);
+    void (*gfx_copy32)(uint32_t *dst, const uint32_t *src, size_t n);
+    void (*gfx_key32)(uint32_t *dst, const uint32_t *src, size_t n,
+                      uint32_t key);
+    void (*gfx_blend32)(uint32_t *dst, const uint32_t *src, size_t n);
+    void (*gfx_rgb888_to_xrgb)(uint32_t *dst, const uint8_t *src, size_t n);
+    void (*gfx_xrgb_to_rgb888)(uint8_t *dst, const uint32_t *src, size_t n);
+    void (*gfx_rgb565_to_xrgb)(uint32_t *dst, const uint16_t *src, size_t n);
+    void (*gfx_xrgb_to_rgb565)(uint16_t *dst, const uint32_t *src, size_t n);
+    void (*gfx_index8_to_xrgb)(uint32_t *dst, const uint8_t *src, size_t n,
+                               const uint32_t *palette);
+    void (*gfx_xrgb_to_index8)(uint8_t *dst, const uint32_t *src, size_t n);
+
+    size_t movsb_threshold; /* memcpy size from which `rep movsb` is used */
+    size_t stosb_threshold; /* memset size from which `rep stosb` is used */
+};
+
+extern struct libk_ops libk_ops;
+
+/* Rebind libk_ops for a set of CPU_FEATURE_* bits from <kernel/x86/cpu.h> */
+void libk_dispatch(uint32_t features);
+
+void  *memcpy_sse2(void *dest, const void *src, size_t size);
+void  *memcpy_avx2(void *dest, const void *src, size_t size);
+void  *memset_sse2(void *mem, int val, size_t size);
+void  *memset_avx2(void *mem, int val, size_t size);
+int    memcmp_sse2(const void *dest, const void *src, size_t size);
+int    memcmp_avx2(const void *dest, const void *src, size_t size);
+size_t strlen_sse2(const char *str);
+size_t strlen_avx2(const char *str);
+
+void gfx_fill32_sse2(uint32_t *dst, uint32_t pixel, size_t n);
+void gfx_fill32_avx2(uint32_t *dst, uint32_t pixel, size_t n);
+void gfx_copy32_sse2(uint32_t *dst, const uint32_t *src, size_t n);
+void gfx_copy32_avx2(uint32_t *dst, const uint32_t *src, size_t n);
+void gfx_key32_sse2(uint32_t *dst, const uint32_t *src, size_t n,
+                    uint32_t key);
+void gfx_key32_avx2(uint32_t *dst, const uint32_t *src, size_t n,
+                    uint32_t key);
+void gfx_blend32_sse2(uint32_t *dst, const uint32_t *src, size_t n);
+void gfx_blend32_avx2(uint32_t *dst, const uint32_t *src, size_t n);
+void gfx_rgb888_to_xrgb_sse2(uint32_t *dst, const uint8_t *src, size_t n);
+void gfx_rgb888_to_xrgb_avx2(uint32_t *dst, const uint8_t *src, size_t n);
+void gfx_xrgb_to_rgb888_sse2(uint8_t *dst, const uint32_t *src, size_t n);
+void gfx_xrgb_to_rgb888_avx2(uint8_t *dst, const uint32_t *src, size_t n);
+void gfx_rgb565_to_xrgb_sse2(uint32_t *dst, const uint16_t *src, size_t n);
+void gfx_rgb565_to_xrgb_avx2(uint32_t *dst, const uint16_t *src, size_t n);
+void gfx_xrgb_to_rgb565_sse2(uint16_t *dst, const uint32_t *src, size_t n);
+void gfx_xrgb_to_rgb565_avx2(uint16_t *dst, const uint32_t *src, size_t n);
+void gfx_index8_to_xrgb_sse2(uint32_t *dst, const uint8_t *src, size_t n,
+                             const uint32_t *palette);
+void gfx_index8_to_xrgb_avx2(uint32_t *dst, const uint8_t *src, size_t n,
+                             const uint32_t *palette);
+void gfx_xrgb_to_index8_sse2(uint8_t *dst, const uint32_t *src, size_t n);
+void gfx_xrgb_to_index8_avx2(uint8_t *dst, const uint32_t *src, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYS_DISPATCH_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
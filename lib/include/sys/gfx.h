@@ -0,0 +1,117 @@
+/* gfx.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SYS_GFX_H
+#define _SYS_GFX_H
+
+#include <sys/cdefs.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 2D drawing over linear pixel buffers: the framebuffer, its back buffer or
+ * any image in memory. The per row work is done by SSE2 and AVX2 kernels
+ * bound through libk_ops, see <sys/dispatch.h>, so the rectangle level code
+ * below only clips and walks rows.
+ *
+ * XRGB8888 is the working format. Fills and copies take any format, colour
+ * keying and blending take XRGB8888 only, with the source alpha in the top
+ * byte for blends. Conversions go through XRGB8888, which is written with an
+ * opaque 0xFF top byte so converted images blend as solid. RGB888 is stored
+ * blue first, as the framebuffer does. Converting to INDEXED8 produces 3-3-2
+ * RGB indices, gfx_palette332() builds the palette that matches them. */
+
+enum gfx_format {
+    GFX_XRGB8888,
+    GFX_RGB888,
+    GFX_RGB565,
+    GFX_INDEXED8,
+};
+
+struct gfx_surface {
+    void           *pixels;
+    size_t          pitch; /* Bytes from one row to the next */
+    uint32_t        width;
+    uint32_t        height;
+    enum gfx_format format;
+    const uint32_t *palette; /* 256 XRGB8888 entries for GFX_INDEXED8 */
+};
+
+/* Bytes per pixel of `format` */
+size_t gfx_bytes(enum gfx_format format);
+
+/* Fill 256 XRGB8888 entries with the colours of the 3-3-2 indices */
+void gfx_palette332(uint32_t *palette);
+
+/* The rectangle operations clip against every surface they touch, so
+ * coordinates may run off either edge. They return 0, or -1 for a format
+ * they do not take. `pixel` is in the format of dst. */
+int gfx_fill(const struct gfx_surface *dst, int x, int y, uint32_t w,
+             uint32_t h, uint32_t pixel);
+
+/* Copy a w x h block between surfaces of the same format. Overlapping blocks
+ * within one surface, as when scrolling, are copied as if through a
+ * temporary. */
+int gfx_blit(const struct gfx_surface *dst, int dx, int dy,
+             const struct gfx_surface *src, int sx, int sy, uint32_t w,
+             uint32_t h);
+
+/* As gfx_blit(), skipping source pixels equal to `key` in their low 24 bits */
+int gfx_blit_key(const struct gfx_surface *dst, int dx, int dy,
+                 const struct gfx_surface *src, int sx, int sy, uint32_t w,
+                 uint32_t h, uint32_t key);
+
+/* Draw src over dst by its per pixel alpha, rounding to nearest */
+int gfx_blend(const struct gfx_surface *dst, int dx, int dy,
+              const struct gfx_surface *src, int sx, int sy, uint32_t w,
+              uint32_t h);
+
+/* Copy a w x h block converting from the format of src to that of dst */
+int gfx_convert(const struct gfx_surface *dst, int dx, int dy,
+                const struct gfx_surface *src, int sx, int sy, uint32_t w,
+                uint32_t h);
+
+/* The row kernels behind the operations above, for callers that do their
+ * own clipping. Counts are in pixels, copies may overlap. */
+void gfx_fill32(uint32_t *dst, uint32_t pixel, size_t n);
+void gfx_copy32(uint32_t *dst, const uint32_t *src, size_t n);
+void gfx_key32(uint32_t *dst, const uint32_t *src, size_t n, uint32_t key);
+void gfx_blend32(uint32_t *dst, const uint32_t *src, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYS_GFX_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,99 @@
+/* klog.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SYS_KLOG_H
+#define _SYS_KLOG_H
+
+#include <sys/cdefs.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The kernel log. printf() appends to a fixed ring of records at memory speed
+ * and console devices catch up later through klog_drain(), so logging never
+ * waits on VGA or a serial line. Writers reserve slots with a single atomic
+ * add and never take a lock. When the consoles fall more than KLOG_SLOTS
+ * records behind the oldest records are overwritten and the drain reports how
+ * many were lost.
+ *
+ * Each reader keeps its own place in the ring. Every console drains through
+ * its own reader at its own pace, so a slow device that falls a lap behind
+ * loses records without holding the fast ones back. klog_drain() and
+ * klog_dump() read through a reader of their own. */
+
+#define KLOG_SLOTS 256 /* Power of two */
+#define KLOG_TEXT  108 /* Text bytes per record, longer writes span records */
+
+struct klog_record {
+    uint64_t seq;   /* Position + 1 once committed, 0 while being written */
+    uint64_t tsc;   /* Time stamp counter when the record was written */
+    uint16_t len;   /* Bytes used in text */
+    uint16_t flags; /* KLOG_CONT when continuing the previous record */
+    char     text[KLOG_TEXT];
+};
+
+#define KLOG_CONT (1u << 0)
+
+struct klog_reader {
+    uint64_t tail; /* Next position to read */
+    int      busy; /* Set while a drain through this reader runs */
+};
+
+/* Append `size` bytes to the log, safe from any context */
+void klog_write(const char *data, size_t size);
+
+/* Hand every committed record not yet drained to `write`, coalesced into as
+ * few calls as possible. Stops at a record still being written. Returns the
+ * number of records drained, 0 if another drain is already running. */
+size_t klog_drain(void (*write)(const char *data, size_t size));
+
+/* klog_drain() for the panic path: skips records that are still being
+ * written instead of waiting on them and ignores any drain in progress */
+size_t klog_dump(void (*write)(const char *data, size_t size));
+
+/* Start `r` at the oldest record still in the ring */
+void klog_reader_init(struct klog_reader *r);
+
+/* klog_drain() and klog_dump() through the reader `r` */
+size_t klog_drain_from(struct klog_reader *r,
+                       void (*write)(const char *data, size_t size));
+size_t klog_dump_from(struct klog_reader *r,
+                      void (*write)(const char *data, size_t size));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYS_KLOG_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,143 @@
+/* kprint.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SYS_KPRINT_H
+#define _SYS_KPRINT_H
+
+#include <sys/cdefs.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* kprint() is printf() with the format taken apart at compile time. Literal
+ * text and values are passed in order and _Generic picks the conversion for
+ * each value from its type:
+ *
+ *     kprint("[mmap] base 0x", kp_hex(mmap->addr), " type ", mmap->type,
+ *            "\n");
+ *
+ * What runs is a straight line of "append this span" and "convert this
+ * value" calls, with the length of every literal folded to a constant and no
+ * format string to scan. The message reaches the kernel log in one write.
+ * Integers print in decimal, pointers and kp_hex() values in hex, char
+ * values as characters (a character constant is an int). A value of any
+ * other type is a compile error. Up to 16 pieces per call. */
+
+#define KPRINT_BUF 256
+
+struct kprint_buf {
+    size_t len;
+    char   buf[KPRINT_BUF];
+};
+
+struct kprint_hex {
+    unsigned long value;
+    unsigned      width; /* Zero padded to at least this many digits */
+};
+
+#define kp_hex(x)     (( struct kprint_hex ){( unsigned long )(x), 0})
+#define kp_hexw(x, w) (( struct kprint_hex ){( unsigned long )(x), (w)})
+
+void kprint_span(struct kprint_buf *kp, const char *str, size_t len);
+void kprint_long(struct kprint_buf *kp, long val);
+void kprint_ulong(struct kprint_buf *kp, unsigned long val);
+void kprint_hex(struct kprint_buf *kp, struct kprint_hex val);
+void kprint_char(struct kprint_buf *kp, char val);
+void kprint_ptr(struct kprint_buf *kp, const void *val);
+void kprint_flush(struct kprint_buf *kp);
+
+/* Inlined so that a literal's length is known at compile time */
+static __always_inline void kprint_str(struct kprint_buf *kp, const char *str)
+{
+    if (!str)
+        str = "(null)";
+    kprint_span(kp, str, __builtin_strlen(str));
+}
+
+#define KPRINT_ARG(kp, x)                                                      \
+    _Generic((x),                                                              \
+            char *: kprint_str,                                                \
+            const char *: kprint_str,                                          \
+            char: kprint_char,                                                 \
+            signed char: kprint_long,                                          \
+            short: kprint_long,                                                \
+            int: kprint_long,                                                  \
+            long: kprint_long,                                                 \
+            long long: kprint_long,                                            \
+            _Bool: kprint_ulong,                                               \
+            unsigned char: kprint_ulong,                                       \
+            unsigned short: kprint_ulong,                                      \
+            unsigned int: kprint_ulong,                                        \
+            unsigned long: kprint_ulong,                                       \
+            unsigned long long: kprint_ulong,                                  \
+            struct kprint_hex: kprint_hex,                                     \
+            default: kprint_ptr)(kp, x)
+
+#define kprint(...)                                                            \
+    do {                                                                       \
+        struct kprint_buf kp_;                                                 \
+        kp_.len = 0;                                                           \
+        KPRINT_CAT(KPRINT_, KPRINT_NARGS(__VA_ARGS__))(&kp_, __VA_ARGS__);     \
+        kprint_flush(&kp_);                                                    \
+    } while (0)
+
+#define KPRINT_CAT(a, b)  KPRINT_CAT_(a, b)
+#define KPRINT_CAT_(a, b) a##b
+#define KPRINT_NARGS(...)                                                      \
+    KPRINT_NTH(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,   \
+               2, 1, 0)
+#define KPRINT_NTH(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, N, ...) N
+
+#define KPRINT_1(kp, x)       KPRINT_ARG(kp, x)
+#define KPRINT_2(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_1(kp, __VA_ARGS__)
+#define KPRINT_3(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_2(kp, __VA_ARGS__)
+#define KPRINT_4(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_3(kp, __VA_ARGS__)
+#define KPRINT_5(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_4(kp, __VA_ARGS__)
+#define KPRINT_6(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_5(kp, __VA_ARGS__)
+#define KPRINT_7(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_6(kp, __VA_ARGS__)
+#define KPRINT_8(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_7(kp, __VA_ARGS__)
+#define KPRINT_9(kp, x, ...)  KPRINT_ARG(kp, x), KPRINT_8(kp, __VA_ARGS__)
+#define KPRINT_10(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_9(kp, __VA_ARGS__)
+#define KPRINT_11(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_10(kp, __VA_ARGS__)
+#define KPRINT_12(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_11(kp, __VA_ARGS__)
+#define KPRINT_13(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_12(kp, __VA_ARGS__)
+#define KPRINT_14(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_13(kp, __VA_ARGS__)
+#define KPRINT_15(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_14(kp, __VA_ARGS__)
+#define KPRINT_16(kp, x, ...) KPRINT_ARG(kp, x), KPRINT_15(kp, __VA_ARGS__)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYS_KPRINT_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
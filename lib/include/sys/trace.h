@@ -0,0 +1,116 @@
+/* trace.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _SYS_TRACE_H
+#define _SYS_TRACE_H
+
+#include <sys/cdefs.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Binary tracing. trace_printf() stores the format pointer, a time stamp,
+ * the CPU and the raw argument words in that CPU's ring and does no
+ * formatting at all; trace_dump() formats the records with the printf
+ * engine when someone wants to read them. Cheap enough for interrupt
+ * handlers and allocators.
+ *
+ * Arguments are captured as unsigned long words, so integers and pointers
+ * only, at most TRACE_ARGS of them. %s arguments are read at dump time and
+ * must still be around then, string literals are safe. */
+
+#define TRACE_CPUS  1   /* Rings, one per CPU once there is more than one */
+#define TRACE_SLOTS 256 /* Records per ring, a power of two */
+#define TRACE_ARGS  5
+
+struct trace_record {
+    const char   *fmt; /* NULL while the record is being written */
+    uint64_t      tsc;
+    unsigned long args[TRACE_ARGS];
+    uint32_t      pos; /* Low bits of the ring position, tells laps apart */
+    uint16_t      cpu;
+    uint16_t      nargs;
+};
+
+void trace_write(const char *fmt, size_t nargs, const unsigned long *args);
+
+/* Format every record not dumped before, oldest first across all CPUs, one
+ * line each prefixed with its time stamp and CPU. Returns the number of
+ * records written out. */
+size_t trace_dump(void (*write)(const char *data, size_t size));
+
+/* Never called, it only gives the compiler a printf prototype to check
+ * trace_printf() arguments against */
+static inline void __printflike(1, 2) trace_check(const char *fmt, ...)
+{
+    ( void )fmt;
+}
+
+/* trace_printf(fmt, ...) counts its arguments and hands them over as words */
+#define trace_printf(...)                                                      \
+    do {                                                                       \
+        if (0)                                                                 \
+            trace_check(__VA_ARGS__);                                          \
+        TRACE_CAT(TRACE_, TRACE_NARGS(__VA_ARGS__))(__VA_ARGS__);              \
+    } while (0)
+
+#define TRACE_CAT(a, b)  TRACE_CAT_(a, b)
+#define TRACE_CAT_(a, b) a##b
+#define TRACE_NARGS(...) TRACE_NTH(__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define TRACE_NTH(f, a, b, c, d, e, n, ...) n
+#define TRACE_W(x)                          (( unsigned long )(x))
+
+#define TRACE_1(f) trace_write(f, 0, NULL)
+#define TRACE_2(f, a)                                                          \
+    trace_write(f, 1, ( const unsigned long[]){TRACE_W(a)})
+#define TRACE_3(f, a, b)                                                       \
+    trace_write(f, 2, ( const unsigned long[]){TRACE_W(a), TRACE_W(b)})
+#define TRACE_4(f, a, b, c)                                                    \
+    trace_write(f, 3,                                                          \
+                ( const unsigned long[]){TRACE_W(a), TRACE_W(b), TRACE_W(c)})
+#define TRACE_5(f, a, b, c, d)                                                 \
+    trace_write(f, 4,                                                          \
+                ( const unsigned long[]){TRACE_W(a), TRACE_W(b), TRACE_W(c),   \
+                                         TRACE_W(d)})
+#define TRACE_6(f, a, b, c, d, e)                                              \
+    trace_write(f, 5,                                                          \
+                ( const unsigned long[]){TRACE_W(a), TRACE_W(b), TRACE_W(c),   \
+                                         TRACE_W(d), TRACE_W(e)})
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYS_TRACE_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
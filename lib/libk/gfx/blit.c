@@ -0,0 +1,292 @@
+/* blit.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gfximpl.h"
+
+/* Fills: one unaligned store for the head, then stores at 16 (32) byte
+ * alignment, then one overlapping store for the tail. Alignment is stepped
+ * in whole pixels so a row that is not 4-byte aligned keeps its phase. */
+void gfx_fill32_sse2(uint32_t *dst, uint32_t pixel, size_t n)
+{
+    v16u8     v   = ( v16u8 )(( v4u32 ){0} + pixel);
+    uint32_t *end = dst + n, *q;
+
+    if (n < 4) {
+        for (; dst < end; ++dst)
+            st32(dst, pixel);
+        return;
+    }
+
+    st128(dst, v);
+    q = dst + ((-( uintptr_t )dst & 15) >> 2);
+    for (; q + 16 <= end; q += 16) {
+        st128(q, v);
+        st128(q + 4, v);
+        st128(q + 8, v);
+        st128(q + 12, v);
+    }
+    for (; q + 4 <= end; q += 4)
+        st128(q, v);
+    st128(end - 4, v);
+}
+
+__avx2 void gfx_fill32_avx2(uint32_t *dst, uint32_t pixel, size_t n)
+{
+    v32u8     v   = ( v32u8 )(( v8u32 ){0} + pixel);
+    uint32_t *end = dst + n, *q;
+
+    if (n < 8) {
+        __builtin_ia32_vzeroupper();
+        gfx_fill32_sse2(dst, pixel, n);
+        return;
+    }
+
+    st256(dst, v);
+    q = dst + ((-( uintptr_t )dst & 31) >> 2);
+    for (; q + 32 <= end; q += 32) {
+        st256(q, v);
+        st256(q + 8, v);
+        st256(q + 16, v);
+        st256(q + 24, v);
+    }
+    for (; q + 8 <= end; q += 8)
+        st256(q, v);
+    st256(end - 8, v);
+}
+
+/* Copies with memmove semantics. Each block is loaded whole before any of
+ * it is stored, so walking away from the overlap is enough. */
+void gfx_copy32_sse2(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    if (( uintptr_t )dst - ( uintptr_t )src >= n * 4) {
+        for (i = 0; i + 8 <= n; i += 8) {
+            v16u8 a = ld128(src + i), b = ld128(src + i + 4);
+            st128(dst + i, a);
+            st128(dst + i + 4, b);
+        }
+        for (; i < n; ++i)
+            st32(dst + i, ld32(src + i));
+        return;
+    }
+
+    /* dst starts inside src, so the copy runs from the end */
+    for (i = n; i >= 8; i -= 8) {
+        v16u8 a = ld128(src + i - 8), b = ld128(src + i - 4);
+        st128(dst + i - 8, a);
+        st128(dst + i - 4, b);
+    }
+    for (; i; --i)
+        st32(dst + i - 1, ld32(src + i - 1));
+}
+
+__avx2 void gfx_copy32_avx2(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    if (( uintptr_t )dst - ( uintptr_t )src >= n * 4) {
+        for (i = 0; i + 16 <= n; i += 16) {
+            v32u8 a = ld256(src + i), b = ld256(src + i + 8);
+            st256(dst + i, a);
+            st256(dst + i + 8, b);
+        }
+        __builtin_ia32_vzeroupper();
+        gfx_copy32_sse2(dst + i, src + i, n - i);
+        return;
+    }
+
+    for (i = n; i >= 16; i -= 16) {
+        v32u8 a = ld256(src + i - 16), b = ld256(src + i - 8);
+        st256(dst + i - 16, a);
+        st256(dst + i - 8, b);
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_copy32_sse2(dst, src, i);
+}
+
+/* Colour keyed copies. Blocks that are all key are not written at all and
+ * blocks with no key are stored without reading dst. The AVX2 kernel masks
+ * its stores, so it never reads dst, which matters when dst is the
+ * framebuffer. */
+void gfx_key32_sse2(uint32_t *dst, const uint32_t *src, size_t n, uint32_t key)
+{
+    const v4u32 k = ( v4u32 ){0} + (key & GFX_RGB);
+    size_t      i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        v4u32    s    = ( v4u32 )ld128(src + i);
+        v4u32    hit  = ( v4u32 )(((s ^ k) & GFX_RGB) == 0);
+        unsigned bits = ( unsigned )__builtin_ia32_movmskps(( v4sf )hit);
+
+        if (bits == 0xF)
+            continue;
+        if (bits)
+            s = (s & ~hit) | (( v4u32 )ld128(dst + i) & hit);
+        st128(dst + i, ( v16u8 )s);
+    }
+    for (; i < n; ++i)
+        st32(dst + i, px_key(ld32(src + i), ld32(dst + i), key));
+}
+
+__avx2 void gfx_key32_avx2(uint32_t *dst, const uint32_t *src, size_t n,
+                           uint32_t key)
+{
+    const v8u32 k = ( v8u32 ){0} + (key & GFX_RGB);
+    size_t      i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        v8u32    s    = ( v8u32 )ld256(src + i);
+        v8u32    hit  = ( v8u32 )(((s ^ k) & GFX_RGB) == 0);
+        unsigned bits = ( unsigned )__builtin_ia32_movmskps256(( v8sf )hit);
+
+        if (bits == 0xFF)
+            continue;
+        if (bits)
+            __builtin_ia32_maskstored256(( v8si * )(dst + i), ( v8si )~hit,
+                                         ( v8si )s);
+        else
+            st256(dst + i, ( v32u8 )s);
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_key32_sse2(dst + i, src + i, n - i, key);
+}
+
+/* Alpha blending works on 16-bit lanes, the bytes of each pixel widened and
+ * its alpha broadcast across them, which gives the same result as
+ * px_blend(). Fully transparent blocks are skipped and fully opaque ones
+ * copied. */
+static __always_inline v8u16 blend_lanes128(v8u16 s, v8u16 d, v8u16 a)
+{
+    v8u16 u = s * a + d * (255 - a) + 128;
+    return (u + (u >> 8)) >> 8;
+}
+
+static __always_inline v16u8 blend128(v16u8 s, v16u8 d)
+{
+    const v16qi z  = {0};
+    v8hi        sl = ( v8hi )__builtin_ia32_punpcklbw128(( v16qi )s, z);
+    v8hi        sh = ( v8hi )__builtin_ia32_punpckhbw128(( v16qi )s, z);
+    v8hi        dl = ( v8hi )__builtin_ia32_punpcklbw128(( v16qi )d, z);
+    v8hi        dh = ( v8hi )__builtin_ia32_punpckhbw128(( v16qi )d, z);
+    v8hi al = __builtin_ia32_pshufhw(__builtin_ia32_pshuflw(sl, 0xFF), 0xFF);
+    v8hi ah = __builtin_ia32_pshufhw(__builtin_ia32_pshuflw(sh, 0xFF), 0xFF);
+
+    sl = ( v8hi )blend_lanes128(( v8u16 )sl, ( v8u16 )dl, ( v8u16 )al);
+    sh = ( v8hi )blend_lanes128(( v8u16 )sh, ( v8u16 )dh, ( v8u16 )ah);
+    return ( v16u8 )__builtin_ia32_packuswb128(sl, sh);
+}
+
+void gfx_blend32_sse2(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        v16u8    s = ld128(src + i);
+        v4u32    a = ( v4u32 )s & GFX_OPAQUE;
+        unsigned opaque =
+                ( unsigned )__builtin_ia32_movmskps(( v4sf )(a == GFX_OPAQUE));
+        unsigned clear = ( unsigned )__builtin_ia32_movmskps(( v4sf )(a == 0));
+
+        if (clear == 0xF)
+            continue;
+        st128(dst + i, opaque == 0xF ? s : blend128(s, ld128(dst + i)));
+    }
+    for (; i < n; ++i)
+        st32(dst + i, px_blend(ld32(src + i), ld32(dst + i)));
+}
+
+static __always_inline __avx2 v16u16 blend_lanes256(v16u16 s, v16u16 d,
+                                                    v16u16 a)
+{
+    v16u16 u = s * a + d * (255 - a) + 128;
+    return (u + (u >> 8)) >> 8;
+}
+
+/* The 256-bit unpacks and packs work within each 128-bit half, so the
+ * pixels come back out in the order they went in */
+static __always_inline __avx2 v32u8 blend256(v32u8 s, v32u8 d)
+{
+    const v32qi z  = {0};
+    v16hi       sl = ( v16hi )__builtin_ia32_punpcklbw256(( v32qi )s, z);
+    v16hi       sh = ( v16hi )__builtin_ia32_punpckhbw256(( v32qi )s, z);
+    v16hi       dl = ( v16hi )__builtin_ia32_punpcklbw256(( v32qi )d, z);
+    v16hi       dh = ( v16hi )__builtin_ia32_punpckhbw256(( v32qi )d, z);
+    v16hi       al = __builtin_ia32_pshufhw256(
+            __builtin_ia32_pshuflw256(sl, 0xFF), 0xFF);
+    v16hi ah = __builtin_ia32_pshufhw256(__builtin_ia32_pshuflw256(sh, 0xFF),
+                                         0xFF);
+
+    sl = ( v16hi )blend_lanes256(( v16u16 )sl, ( v16u16 )dl, ( v16u16 )al);
+    sh = ( v16hi )blend_lanes256(( v16u16 )sh, ( v16u16 )dh, ( v16u16 )ah);
+    return ( v32u8 )__builtin_ia32_packuswb256(sl, sh);
+}
+
+__avx2 void gfx_blend32_avx2(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        v32u8    s      = ld256(src + i);
+        v8u32    a      = ( v8u32 )s & GFX_OPAQUE;
+        unsigned opaque = ( unsigned )__builtin_ia32_movmskps256(
+                ( v8sf )(a == GFX_OPAQUE));
+        unsigned clear =
+                ( unsigned )__builtin_ia32_movmskps256(( v8sf )(a == 0));
+
+        if (clear == 0xFF)
+            continue;
+        st256(dst + i, opaque == 0xFF ? s : blend256(s, ld256(dst + i)));
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_blend32_sse2(dst + i, src + i, n - i);
+}
+
+void gfx_fill32(uint32_t *dst, uint32_t pixel, size_t n)
+{
+    libk_ops.gfx_fill32(dst, pixel, n);
+}
+
+void gfx_copy32(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    libk_ops.gfx_copy32(dst, src, n);
+}
+
+void gfx_key32(uint32_t *dst, const uint32_t *src, size_t n, uint32_t key)
+{
+    libk_ops.gfx_key32(dst, src, n, key);
+}
+
+void gfx_blend32(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    libk_ops.gfx_blend32(dst, src, n);
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
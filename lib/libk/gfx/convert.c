@@ -0,0 +1,283 @@
+/* convert.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gfximpl.h"
+
+/* Pixel format conversion to and from XRGB8888. The AVX2 kernels hand the
+ * last pixels of a row to the SSE2 kernels, which finish with the scalar
+ * forms from gfximpl.h. */
+
+/* RGB888 to XRGB8888. Four pixels are twelve bytes, read as eight and four
+ * so nothing past the row is touched. SSE2 has no byte shuffle, so each
+ * pixel is shifted down to the bottom of a copy and the low dwords are
+ * interleaved back together. */
+void gfx_rgb888_to_xrgb_sse2(uint32_t *dst, const uint8_t *src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= n; i += 4, src += 12) {
+        v2di  v  = ( v2di )(( v2u64 ){ld64(src), ld32(src + 8)});
+        v4si  p1 = ( v4si )__builtin_ia32_psrldqi128(v, 24);
+        v4si  p2 = ( v4si )__builtin_ia32_psrldqi128(v, 48);
+        v4si  p3 = ( v4si )__builtin_ia32_psrldqi128(v, 72);
+        v2di  lo = ( v2di )__builtin_ia32_punpckldq128(( v4si )v, p1);
+        v2di  hi = ( v2di )__builtin_ia32_punpckldq128(p2, p3);
+        v4u32 px = ( v4u32 )__builtin_ia32_punpcklqdq128(lo, hi);
+
+        st128(dst + i, ( v16u8 )((px & GFX_RGB) | GFX_OPAQUE));
+    }
+    for (; i < n; ++i, src += 3)
+        st32(dst + i, px_from_rgb888(src));
+}
+
+/* Eight pixels are 24 bytes, loaded as the 16 at 0 and the 16 at 8 so
+ * pixels 0-3 and 4-7 each land in one half for the in-lane byte shuffle */
+__avx2 void gfx_rgb888_to_xrgb_avx2(uint32_t *dst, const uint8_t *src,
+                                    size_t n)
+{
+    const v32qi shuf = {0,  1,  2,  -1, 3,  4,  5,  -1,
+                        6,  7,  8,  -1, 9,  10, 11, -1,
+                        4,  5,  6,  -1, 7,  8,  9,  -1,
+                        10, 11, 12, -1, 13, 14, 15, -1};
+    size_t      i;
+
+    for (i = 0; i + 8 <= n; i += 8, src += 24) {
+        v2di  lo = ( v2di )ld128(src), hi = ( v2di )ld128(src + 8);
+        v4di  v  = {lo[0], lo[1], hi[0], hi[1]};
+        v8u32 px = ( v8u32 )__builtin_ia32_pshufb256(( v32qi )v, shuf);
+
+        st256(dst + i, ( v32u8 )(px | GFX_OPAQUE));
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_rgb888_to_xrgb_sse2(dst + i, src, n - i);
+}
+
+/* XRGB8888 to RGB888. Each pair of pixels is squeezed into the low six
+ * bytes of a quadword and the two quadwords are stored as eight and four
+ * bytes, so nothing past the row is written. */
+void gfx_xrgb_to_rgb888_sse2(uint8_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= n; i += 4, dst += 12) {
+        v2u64 q = ( v2u64 )ld128(src + i);
+
+        q = (q & 0xFFFFFF) | ((q >> 8) & 0xFFFFFF000000);
+        st64(dst, q[0] | q[1] << 48);
+        st32(dst + 8, ( uint32_t )(q[1] >> 16));
+    }
+    for (; i < n; ++i, dst += 3)
+        px_to_rgb888(dst, ld32(src + i));
+}
+
+/* The shuffle packs each half into its low twelve bytes and the dword
+ * permute closes the gap between them */
+__avx2 void gfx_xrgb_to_rgb888_avx2(uint8_t *dst, const uint32_t *src,
+                                    size_t n)
+{
+    const v32qi shuf = {0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+                        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1};
+    const v8si  perm = {0, 1, 2, 4, 5, 6, 3, 7};
+    size_t      i;
+
+    for (i = 0; i + 8 <= n; i += 8, dst += 24) {
+        v8si b = ( v8si )__builtin_ia32_pshufb256(( v32qi )ld256(src + i),
+                                                  shuf);
+
+        b = __builtin_ia32_permvarsi256(b, perm);
+        st128(dst, ( v16u8 )__builtin_ia32_si_si256(b));
+        st64(dst + 16, ( uint64_t )(( v4di )b)[2]);
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_xrgb_to_rgb888_sse2(dst, src + i, n - i);
+}
+
+/* RGB565 to XRGB8888, eight pixels zero extended to two vectors of dwords
+ * at a time */
+void gfx_rgb565_to_xrgb_sse2(uint32_t *dst, const uint16_t *src, size_t n)
+{
+    const v8hi z = {0};
+    size_t     i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        v8hi  v  = ( v8hi )ld128(src + i);
+        v4u32 lo = ( v4u32 )__builtin_ia32_punpcklwd128(v, z);
+        v4u32 hi = ( v4u32 )__builtin_ia32_punpckhwd128(v, z);
+
+        st128(dst + i, ( v16u8 )RGB565_TO_XRGB(lo));
+        st128(dst + i + 4, ( v16u8 )RGB565_TO_XRGB(hi));
+    }
+    for (; i < n; ++i)
+        st32(dst + i, px_from_rgb565(ld16(src + i)));
+}
+
+__avx2 void gfx_rgb565_to_xrgb_avx2(uint32_t *dst, const uint16_t *src,
+                                    size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        v8u32 lo = ( v8u32 )__builtin_ia32_pmovzxwd256(( v8hi )ld128(src + i));
+        v8u32 hi = ( v8u32 )__builtin_ia32_pmovzxwd256(
+                ( v8hi )ld128(src + i + 8));
+
+        st256(dst + i, ( v32u8 )RGB565_TO_XRGB(lo));
+        st256(dst + i + 8, ( v32u8 )RGB565_TO_XRGB(hi));
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_rgb565_to_xrgb_sse2(dst + i, src + i, n - i);
+}
+
+/* XRGB8888 to RGB565. The signed saturating pack is the only dword to word
+ * pack SSE2 has, so the results are sign extended first to pass through it
+ * unchanged. */
+static __always_inline v4si to_rgb565_128(v4u32 p)
+{
+    return (( v4si )XRGB_TO_RGB565(p) << 16) >> 16;
+}
+
+void gfx_xrgb_to_rgb565_sse2(uint16_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        v4si lo = to_rgb565_128(( v4u32 )ld128(src + i));
+        v4si hi = to_rgb565_128(( v4u32 )ld128(src + i + 4));
+
+        st128(dst + i, ( v16u8 )__builtin_ia32_packssdw128(lo, hi));
+    }
+    for (; i < n; ++i)
+        st16(dst + i, px_to_rgb565(ld32(src + i)));
+}
+
+static __always_inline __avx2 v8si to_rgb565_256(v8u32 p)
+{
+    return (( v8si )XRGB_TO_RGB565(p) << 16) >> 16;
+}
+
+/* The 256-bit pack interleaves the halves of its inputs, the quadword
+ * permute puts them back in order */
+__avx2 void gfx_xrgb_to_rgb565_avx2(uint16_t *dst, const uint32_t *src,
+                                    size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        v8si lo = to_rgb565_256(( v8u32 )ld256(src + i));
+        v8si hi = to_rgb565_256(( v8u32 )ld256(src + i + 8));
+        v4di w  = ( v4di )__builtin_ia32_packssdw256(lo, hi);
+
+        st256(dst + i, ( v32u8 )__builtin_ia32_permdi256(w, 0xD8));
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_xrgb_to_rgb565_sse2(dst + i, src + i, n - i);
+}
+
+/* INDEXED8 to XRGB8888 is a table lookup. SSE2 has no gather, so it is an
+ * unrolled scalar loop, AVX2 gathers eight entries at a time. */
+void gfx_index8_to_xrgb_sse2(uint32_t *dst, const uint8_t *src, size_t n,
+                             const uint32_t *palette)
+{
+    size_t i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        uint32_t w = ld32(src + i);
+        st32(dst + i, palette[w & 0xFF]);
+        st32(dst + i + 1, palette[(w >> 8) & 0xFF]);
+        st32(dst + i + 2, palette[(w >> 16) & 0xFF]);
+        st32(dst + i + 3, palette[w >> 24]);
+    }
+    for (; i < n; ++i)
+        st32(dst + i, palette[src[i]]);
+}
+
+__avx2 void gfx_index8_to_xrgb_avx2(uint32_t *dst, const uint8_t *src,
+                                    size_t n, const uint32_t *palette)
+{
+    const v8si all = {-1, -1, -1, -1, -1, -1, -1, -1};
+    size_t     i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        v16qi idx = ( v16qi )(( v2u64 ){ld64(src + i), 0});
+        v8si  px  = __builtin_ia32_gathersiv8si(
+                ( v8si ){0}, ( const int * )palette,
+                __builtin_ia32_pmovzxbd256(idx), all, 4);
+
+        st256(dst + i, ( v32u8 )px);
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_index8_to_xrgb_sse2(dst + i, src + i, n - i, palette);
+}
+
+/* XRGB8888 to 3-3-2 indices, sixteen pixels packed dword to word to byte
+ * per store. The indices are below 256, so the saturating packs pass them
+ * through unchanged. */
+void gfx_xrgb_to_index8_sse2(uint8_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        v4si a  = ( v4si )XRGB_TO_INDEX8(( v4u32 )ld128(src + i));
+        v4si b  = ( v4si )XRGB_TO_INDEX8(( v4u32 )ld128(src + i + 4));
+        v4si c  = ( v4si )XRGB_TO_INDEX8(( v4u32 )ld128(src + i + 8));
+        v4si d  = ( v4si )XRGB_TO_INDEX8(( v4u32 )ld128(src + i + 12));
+        v8hi ab = __builtin_ia32_packssdw128(a, b);
+        v8hi cd = __builtin_ia32_packssdw128(c, d);
+
+        st128(dst + i, ( v16u8 )__builtin_ia32_packuswb128(ab, cd));
+    }
+    for (; i < n; ++i)
+        dst[i] = px_to_index8(ld32(src + i));
+}
+
+/* The packs work within halves, leaving the dwords holding pixels 0-3,
+ * 8-11, 16-19, 24-27, 4-7, ..., which the permute puts back in order */
+__avx2 void gfx_xrgb_to_index8_avx2(uint8_t *dst, const uint32_t *src,
+                                    size_t n)
+{
+    const v8si perm = {0, 4, 1, 5, 2, 6, 3, 7};
+    size_t     i;
+
+    for (i = 0; i + 32 <= n; i += 32) {
+        v8si  a  = ( v8si )XRGB_TO_INDEX8(( v8u32 )ld256(src + i));
+        v8si  b  = ( v8si )XRGB_TO_INDEX8(( v8u32 )ld256(src + i + 8));
+        v8si  c  = ( v8si )XRGB_TO_INDEX8(( v8u32 )ld256(src + i + 16));
+        v8si  d  = ( v8si )XRGB_TO_INDEX8(( v8u32 )ld256(src + i + 24));
+        v16hi ab = __builtin_ia32_packssdw256(a, b);
+        v16hi cd = __builtin_ia32_packssdw256(c, d);
+        v8si  px = ( v8si )__builtin_ia32_packuswb256(ab, cd);
+
+        st256(dst + i, ( v32u8 )__builtin_ia32_permvarsi256(px, perm));
+    }
+    __builtin_ia32_vzeroupper();
+    gfx_xrgb_to_index8_sse2(dst + i, src + i, n - i);
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,277 @@
+/* gfx.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "gfximpl.h"
+
+/* Conversions between two formats other than XRGB8888 go through a row
+ * buffer of this many pixels on the stack */
+#define GFX_CHUNK 128
+
+/* A block clipped to its surfaces: the first pixel of its first row in each
+ * and its size in pixels */
+struct gfx_block {
+    uint8_t       *dst;
+    const uint8_t *src;
+    size_t         w, h;
+};
+
+static const uint8_t gfx_bytes_per[] = {
+        [GFX_XRGB8888] = 4,
+        [GFX_RGB888]   = 3,
+        [GFX_RGB565]   = 2,
+        [GFX_INDEXED8] = 1,
+};
+
+size_t gfx_bytes(enum gfx_format format) { return gfx_bytes_per[format]; }
+
+void gfx_palette332(uint32_t *palette)
+{
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t r = (i >> 5) * 255 / 7;
+        uint32_t g = ((i >> 2) & 7) * 255 / 7;
+        uint32_t b = (i & 3) * 255 / 3;
+        palette[i] = GFX_OPAQUE | r << 16 | g << 8 | b;
+    }
+}
+
+/* Clip one axis of a block `len` long at `d` in dst and `s` in src to both
+ * surfaces and return what is left of it, which may be nothing or less */
+static int64_t clip_axis(int64_t *d, int64_t *s, int64_t len, uint32_t dlim,
+                         uint32_t slim)
+{
+    int64_t skip = 0;
+
+    if (*d < 0)
+        skip = -*d;
+    if (*s < 0 && -*s > skip)
+        skip = -*s;
+    *d  += skip;
+    *s  += skip;
+    len -= skip;
+    if (len > dlim - *d)
+        len = dlim - *d;
+    if (len > slim - *s)
+        len = slim - *s;
+    return len;
+}
+
+static int gfx_clip(struct gfx_block *b, const struct gfx_surface *dst,
+                    int dx, int dy, const struct gfx_surface *src, int sx,
+                    int sy, uint32_t w, uint32_t h)
+{
+    int64_t x = dx, y = dy, u = sx, v = sy;
+    int64_t cw = clip_axis(&x, &u, w, dst->width, src->width);
+    int64_t ch = clip_axis(&y, &v, h, dst->height, src->height);
+
+    if (cw <= 0 || ch <= 0)
+        return 0;
+    b->dst = ( uint8_t * )dst->pixels + ( size_t )y * dst->pitch +
+             ( size_t )x * gfx_bytes(dst->format);
+    b->src = ( const uint8_t * )src->pixels + ( size_t )v * src->pitch +
+             ( size_t )u * gfx_bytes(src->format);
+    b->w   = ( size_t )cw;
+    b->h   = ( size_t )ch;
+    return 1;
+}
+
+/* 16-bit rows are filled as pixel pairs, 24-bit ones a pixel at a time */
+static void fill_row(uint8_t *row, enum gfx_format format, uint32_t pixel,
+                     size_t w)
+{
+    switch (format) {
+    case GFX_XRGB8888:
+        libk_ops.gfx_fill32(( uint32_t * )row, pixel, w);
+        break;
+    case GFX_RGB888:
+        for (; w; --w, row += 3)
+            px_to_rgb888(row, pixel);
+        break;
+    case GFX_RGB565:
+        libk_ops.gfx_fill32(( uint32_t * )row, (pixel & 0xFFFF) * 0x10001,
+                            w / 2);
+        if (w & 1)
+            st16(row + w * 2 - 2, ( uint16_t )pixel);
+        break;
+    case GFX_INDEXED8:
+        memset(row, ( int )( uint8_t )pixel, w);
+        break;
+    }
+}
+
+int gfx_fill(const struct gfx_surface *dst, int x, int y, uint32_t w,
+             uint32_t h, uint32_t pixel)
+{
+    struct gfx_block b;
+
+    if (!gfx_clip(&b, dst, x, y, dst, x, y, w, h))
+        return 0;
+    for (; b.h; --b.h, b.dst += dst->pitch)
+        fill_row(b.dst, dst->format, pixel, b.w);
+    return 0;
+}
+
+int gfx_blit(const struct gfx_surface *dst, int dx, int dy,
+             const struct gfx_surface *src, int sx, int sy, uint32_t w,
+             uint32_t h)
+{
+    struct gfx_block b;
+    int64_t          dp = ( int64_t )dst->pitch, sp = ( int64_t )src->pitch;
+    size_t           bytes;
+
+    if (dst->format != src->format)
+        return -1;
+    if (!gfx_clip(&b, dst, dx, dy, src, sx, sy, w, h))
+        return 0;
+    bytes = b.w * gfx_bytes(dst->format);
+
+    /* When dst starts inside src the rows go bottom up, so every source
+     * row is read before the copy reaches it. Overlap within a row is left
+     * to the row copy. */
+    if (b.dst > b.src && b.dst < b.src + b.h * src->pitch) {
+        b.dst += ( int64_t )(b.h - 1) * dp;
+        b.src += ( int64_t )(b.h - 1) * sp;
+        dp     = -dp;
+        sp     = -sp;
+    }
+
+    for (; b.h; --b.h, b.dst += dp, b.src += sp) {
+        if (dst->format == GFX_XRGB8888)
+            libk_ops.gfx_copy32(( uint32_t * )b.dst,
+                                ( const uint32_t * )b.src, b.w);
+        else
+            memmove(b.dst, b.src, bytes);
+    }
+    return 0;
+}
+
+int gfx_blit_key(const struct gfx_surface *dst, int dx, int dy,
+                 const struct gfx_surface *src, int sx, int sy, uint32_t w,
+                 uint32_t h, uint32_t key)
+{
+    struct gfx_block b;
+
+    if (dst->format != GFX_XRGB8888 || src->format != GFX_XRGB8888)
+        return -1;
+    if (!gfx_clip(&b, dst, dx, dy, src, sx, sy, w, h))
+        return 0;
+    for (; b.h; --b.h, b.dst += dst->pitch, b.src += src->pitch)
+        libk_ops.gfx_key32(( uint32_t * )b.dst, ( const uint32_t * )b.src,
+                           b.w, key);
+    return 0;
+}
+
+int gfx_blend(const struct gfx_surface *dst, int dx, int dy,
+              const struct gfx_surface *src, int sx, int sy, uint32_t w,
+              uint32_t h)
+{
+    struct gfx_block b;
+
+    if (dst->format != GFX_XRGB8888 || src->format != GFX_XRGB8888)
+        return -1;
+    if (!gfx_clip(&b, dst, dx, dy, src, sx, sy, w, h))
+        return 0;
+    for (; b.h; --b.h, b.dst += dst->pitch, b.src += src->pitch)
+        libk_ops.gfx_blend32(( uint32_t * )b.dst, ( const uint32_t * )b.src,
+                             b.w);
+    return 0;
+}
+
+static void to_xrgb(uint32_t *dst, const uint8_t *src, size_t n,
+                    const struct gfx_surface *from)
+{
+    switch (from->format) {
+    case GFX_XRGB8888:
+        libk_ops.gfx_copy32(dst, ( const uint32_t * )src, n);
+        break;
+    case GFX_RGB888:
+        libk_ops.gfx_rgb888_to_xrgb(dst, src, n);
+        break;
+    case GFX_RGB565:
+        libk_ops.gfx_rgb565_to_xrgb(dst, ( const uint16_t * )src, n);
+        break;
+    case GFX_INDEXED8:
+        libk_ops.gfx_index8_to_xrgb(dst, src, n, from->palette);
+        break;
+    }
+}
+
+static void from_xrgb(uint8_t *dst, const uint32_t *src, size_t n,
+                      enum gfx_format to)
+{
+    switch (to) {
+    case GFX_XRGB8888:
+        libk_ops.gfx_copy32(( uint32_t * )dst, src, n);
+        break;
+    case GFX_RGB888:
+        libk_ops.gfx_xrgb_to_rgb888(dst, src, n);
+        break;
+    case GFX_RGB565:
+        libk_ops.gfx_xrgb_to_rgb565(( uint16_t * )dst, src, n);
+        break;
+    case GFX_INDEXED8:
+        libk_ops.gfx_xrgb_to_index8(dst, src, n);
+        break;
+    }
+}
+
+int gfx_convert(const struct gfx_surface *dst, int dx, int dy,
+                const struct gfx_surface *src, int sx, int sy, uint32_t w,
+                uint32_t h)
+{
+    struct gfx_block b;
+    uint32_t         row[GFX_CHUNK];
+    size_t           db = gfx_bytes(dst->format), sb = gfx_bytes(src->format);
+
+    if (dst->format == src->format)
+        return gfx_blit(dst, dx, dy, src, sx, sy, w, h);
+    if (src->format == GFX_INDEXED8 && !src->palette)
+        return -1;
+    if (!gfx_clip(&b, dst, dx, dy, src, sx, sy, w, h))
+        return 0;
+
+    for (; b.h; --b.h, b.dst += dst->pitch, b.src += src->pitch) {
+        if (src->format == GFX_XRGB8888) {
+            from_xrgb(b.dst, ( const uint32_t * )b.src, b.w, dst->format);
+        } else if (dst->format == GFX_XRGB8888) {
+            to_xrgb(( uint32_t * )b.dst, b.src, b.w, src);
+        } else {
+            for (size_t x = 0, n; x < b.w; x += n) {
+                n = b.w - x < GFX_CHUNK ? b.w - x : GFX_CHUNK;
+                to_xrgb(row, b.src + x * sb, n, src);
+                from_xrgb(b.dst + x * db, row, n, dst->format);
+            }
+        }
+    }
+    return 0;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,130 @@
+/* gfximpl.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LIBK_GFXIMPL_H
+#define _LIBK_GFXIMPL_H
+
+#include <sys/gfx.h>
+
+#include "../string/memimpl.h"
+
+/* Shared helpers for the pixel row kernels. Every kernel has a scalar form
+ * of its per pixel work here, which the vector loops fall back to for the
+ * last few pixels of a row and which the tests treat as the reference. */
+
+typedef short    v8hi __attribute__((__vector_size__(16), __may_alias__));
+typedef int      v4si __attribute__((__vector_size__(16), __may_alias__));
+typedef uint16_t v8u16 __attribute__((__vector_size__(16), __may_alias__));
+typedef uint32_t v4u32 __attribute__((__vector_size__(16), __may_alias__));
+typedef float    v4sf __attribute__((__vector_size__(16), __may_alias__));
+
+typedef short    v16hi __attribute__((__vector_size__(32), __may_alias__));
+typedef int      v8si __attribute__((__vector_size__(32), __may_alias__));
+typedef long long v4di __attribute__((__vector_size__(32), __may_alias__));
+typedef uint16_t v16u16 __attribute__((__vector_size__(32), __may_alias__));
+typedef uint32_t v8u32 __attribute__((__vector_size__(32), __may_alias__));
+typedef float    v8sf __attribute__((__vector_size__(32), __may_alias__));
+
+/* The AVX2 kernels pass the last pixels of a row to the SSE2 ones. GCC
+ * leaves the vzeroupper out of such tail calls, and SSE2 code running with
+ * the upper halves of the registers dirty is slowed on every instruction,
+ * so they clear them by hand first with __builtin_ia32_vzeroupper(). */
+
+#define GFX_OPAQUE 0xFF000000u
+#define GFX_RGB    0x00FFFFFFu
+
+/* One source channel over one destination channel by alpha `a`. With
+ * u = x + 128, (u + (u >> 8)) >> 8 is x / 255 rounded to nearest for every
+ * x up to 255 * 255, and stays within 16 bits for the vector kernels. */
+static __always_inline uint32_t blend_channel(uint32_t s, uint32_t d,
+                                              uint32_t a)
+{
+    uint32_t u = s * a + d * (255 - a) + 128;
+    return (u + (u >> 8)) >> 8;
+}
+
+static __always_inline uint32_t px_blend(uint32_t s, uint32_t d)
+{
+    uint32_t a = s >> 24, p = 0;
+
+    for (unsigned sh = 0; sh < 32; sh += 8)
+        p |= blend_channel((s >> sh) & 0xFF, (d >> sh) & 0xFF, a) << sh;
+    return p;
+}
+
+static __always_inline uint32_t px_key(uint32_t s, uint32_t d, uint32_t key)
+{
+    return ((s ^ key) & GFX_RGB) ? s : d;
+}
+
+/* Format conversions between XRGB8888 and 32-bit lanes, written so they
+ * take a scalar or a vector of any width alike. Narrowing truncates, and
+ * widening repeats the top bits of a channel so 0x1F becomes 0xFF. */
+#define RGB565_TO_XRGB(v)                                                      \
+    (GFX_OPAQUE | (((v) << 8) & 0xF80000) | (((v) << 3) & 0x070000) |          \
+     (((v) << 5) & 0x00FC00) | (((v) >> 1) & 0x000300) |                       \
+     (((v) << 3) & 0x0000F8) | (((v) >> 2) & 0x000007))
+
+#define XRGB_TO_RGB565(p)                                                      \
+    ((((p) >> 8) & 0xF800) | (((p) >> 5) & 0x07E0) | (((p) >> 3) & 0x001F))
+
+#define XRGB_TO_INDEX8(p)                                                      \
+    ((((p) >> 16) & 0xE0) | (((p) >> 11) & 0x1C) | (((p) >> 6) & 0x03))
+
+static __always_inline uint32_t px_from_rgb565(uint32_t v)
+{
+    return RGB565_TO_XRGB(v);
+}
+
+static __always_inline uint16_t px_to_rgb565(uint32_t p)
+{
+    return ( uint16_t )XRGB_TO_RGB565(p);
+}
+
+static __always_inline uint8_t px_to_index8(uint32_t p)
+{
+    return ( uint8_t )XRGB_TO_INDEX8(p);
+}
+
+static __always_inline uint32_t px_from_rgb888(const uint8_t *s)
+{
+    return GFX_OPAQUE | s[0] | ( uint32_t )s[1] << 8 | ( uint32_t )s[2] << 16;
+}
+
+static __always_inline void px_to_rgb888(uint8_t *d, uint32_t p)
+{
+    d[0] = ( uint8_t )p;
+    d[1] = ( uint8_t )(p >> 8);
+    d[2] = ( uint8_t )(p >> 16);
+}
+
+#endif /* _LIBK_GFXIMPL_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
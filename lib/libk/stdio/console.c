@@ -0,0 +1,130 @@
+/* console.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/console.h>
+#include <sys/klog.h>
+
+#define CONSOLE_NAMES 64
+
+static struct console *consoles;
+static char            console_names[CONSOLE_NAMES]; /* Empty selects all */
+static size_t          console_names_len;
+
+static bool console_selected(const char *name)
+{
+    const char  *list = console_names;
+    const char  *end  = console_names + console_names_len;
+    const size_t len  = strlen(name);
+
+    if (!console_names_len)
+        return true;
+    while (list < end) {
+        const char *comma = memchr(list, ',', ( size_t )(end - list));
+        size_t      n     = comma ? ( size_t )(comma - list)
+                                  : ( size_t )(end - list);
+        if (n == len && !memcmp(list, name, len))
+            return true;
+        list += n + 1;
+    }
+    return false;
+}
+
+void console_register(struct console *con)
+{
+    struct console **link = &consoles;
+
+    klog_reader_init(&con->log);
+    con->flags = console_selected(con->name) ? CONSOLE_ENABLED : 0;
+    con->next  = NULL;
+    /* Kept in the order they came up, which is the order they are fed */
+    while (*link)
+        link = &(*link)->next;
+    *link = con;
+}
+
+void console_select(const char *names, size_t len)
+{
+    if (len > CONSOLE_NAMES)
+        len = CONSOLE_NAMES;
+    memcpy(console_names, names, len);
+    console_names_len = len;
+    for (struct console *con = consoles; con; con = con->next) {
+        if (console_selected(con->name))
+            con->flags |= CONSOLE_ENABLED;
+        else
+            con->flags &= ~CONSOLE_ENABLED;
+    }
+}
+
+void console_parse_cmdline(const char *cmdline)
+{
+    const char *word = cmdline;
+
+    while (*word) {
+        size_t len = 0;
+        while (word[len] && word[len] != ' ')
+            ++len;
+        if (len > 8 && !memcmp(word, "console=", 8))
+            console_select(word + 8, len - 8);
+        word += len;
+        while (*word == ' ')
+            ++word;
+    }
+}
+
+void console_write(const char *data, size_t size)
+{
+    for (struct console *con = consoles; con; con = con->next)
+        if (con->flags & CONSOLE_ENABLED)
+            con->write(data, size);
+}
+
+void console_drain(void)
+{
+    for (struct console *con = consoles; con; con = con->next)
+        if (con->flags & CONSOLE_ENABLED)
+            klog_drain_from(&con->log, con->write);
+}
+
+void console_dump(void)
+{
+    for (struct console *con = consoles; con; con = con->next) {
+        if (!(con->flags & CONSOLE_ENABLED))
+            continue;
+        if (con->panic)
+            con->panic();
+        klog_dump_from(&con->log, con->write);
+    }
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,370 @@
+/* format.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/numconv.h>
+
+#include "format.h"
+
+#define FLAG_LEFT  (1u << 0) /* '-' */
+#define FLAG_ZERO  (1u << 1) /* '0' */
+#define FLAG_PLUS  (1u << 2) /* '+' */
+#define FLAG_SPACE (1u << 3) /* ' ' */
+#define FLAG_ALT   (1u << 4) /* '#' */
+
+struct spec {
+    unsigned flags;
+    size_t   width;
+    int      precision; /* -1 when not given */
+};
+
+static void emit(struct fmt_out *out, const char *data, size_t size)
+{
+    out->total += size;
+    while (size) {
+        size_t room = out->size - out->len;
+        if (size <= room) {
+            memcpy(out->buf + out->len, data, size);
+            out->len += size;
+            return;
+        }
+        if (!out->flush) {
+            memcpy(out->buf + out->len, data, room);
+            out->len += room;
+            return;
+        }
+        if (!out->len) {
+            /* Bigger than the whole buffer, send it straight through */
+            out->flush(data, size);
+            return;
+        }
+        out->flush(out->buf, out->len);
+        out->len = 0;
+    }
+}
+
+static void emit_fill(struct fmt_out *out, char c, size_t count)
+{
+    char fill[32];
+
+    if (!count)
+        return;
+    memset(fill, c, count < sizeof(fill) ? count : sizeof(fill));
+    while (count) {
+        size_t n = count < sizeof(fill) ? count : sizeof(fill);
+        emit(out, fill, n);
+        count -= n;
+    }
+}
+
+/* Lay out [prefix][zeros][body] in the field, padded on the left or right */
+static void emit_field(struct fmt_out *out, const struct spec *sp,
+                       const char *prefix, size_t prefix_len, size_t zeros,
+                       const char *body, size_t body_len)
+{
+    size_t used = prefix_len + zeros + body_len;
+    size_t pad  = sp->width > used ? sp->width - used : 0;
+
+    if (!(sp->flags & FLAG_LEFT))
+        emit_fill(out, ' ', pad);
+    emit(out, prefix, prefix_len);
+    emit_fill(out, '0', zeros);
+    emit(out, body, body_len);
+    if (sp->flags & FLAG_LEFT)
+        emit_fill(out, ' ', pad);
+}
+
+static void emit_int(struct fmt_out *out, const struct spec *sp,
+                     unsigned long n, bool negative, unsigned base, bool upper)
+{
+    char   digits[66];
+    char   prefix[3];
+    size_t plen = 0, len, zeros = 0;
+
+    if (negative)
+        prefix[plen++] = '-';
+    else if (sp->flags & FLAG_PLUS)
+        prefix[plen++] = '+';
+    else if (sp->flags & FLAG_SPACE)
+        prefix[plen++] = ' ';
+
+    if ((sp->flags & FLAG_ALT) && n) {
+        if (base == 16) {
+            prefix[plen++] = '0';
+            prefix[plen++] = upper ? 'X' : 'x';
+        } else if (base == 2) {
+            prefix[plen++] = '0';
+            prefix[plen++] = 'b';
+        }
+    }
+
+    /* An explicit zero precision prints nothing for zero */
+    len = sp->precision == 0 && !n ? 0 : utostr(digits, n, base);
+    if (upper)
+        for (size_t i = 0; i < len; ++i)
+            if (digits[i] >= 'a')
+                digits[i] = ( char )(digits[i] - 'a' + 'A');
+
+    if (sp->precision >= 0) {
+        if (( size_t )sp->precision > len)
+            zeros = ( size_t )sp->precision - len;
+    } else if ((sp->flags & (FLAG_ZERO | FLAG_LEFT)) == FLAG_ZERO &&
+               sp->width > plen + len) {
+        zeros = sp->width - plen - len;
+    }
+    /* %#o only promises a leading zero, which padding may already give */
+    if ((sp->flags & FLAG_ALT) && base == 8 && !zeros &&
+        (!len || digits[0] != '0'))
+        zeros = 1;
+
+    emit_field(out, sp, prefix, plen, zeros, digits, len);
+}
+
+/* Arguments come from a va_list or, for trace records, from the words that
+ * were captured when the record was written. Words run out as zeros. */
+struct fmt_args {
+    va_list              ap;
+    const unsigned long *words;
+    size_t               nwords;
+};
+
+static unsigned long arg_word(struct fmt_args *args)
+{
+    if (!args->nwords)
+        return 0;
+    args->nwords--;
+    return *args->words++;
+}
+
+static long arg_int(struct fmt_args *args)
+{
+    return args->words ? ( int )arg_word(args) : va_arg(args->ap, int);
+}
+
+static long arg_long(struct fmt_args *args)
+{
+    return args->words ? ( long )arg_word(args) : va_arg(args->ap, long);
+}
+
+static unsigned long arg_uint(struct fmt_args *args)
+{
+    return args->words ? ( unsigned int )arg_word(args)
+                       : va_arg(args->ap, unsigned int);
+}
+
+static unsigned long arg_ulong(struct fmt_args *args)
+{
+    return args->words ? arg_word(args) : va_arg(args->ap, unsigned long);
+}
+
+static const void *arg_ptr(struct fmt_args *args)
+{
+    return args->words ? ( const void * )arg_word(args)
+                       : va_arg(args->ap, const void *);
+}
+
+static size_t parse_num(const char **fmt)
+{
+    size_t n = 0;
+    while (**fmt >= '0' && **fmt <= '9')
+        n = n * 10 + ( size_t )(*(*fmt)++ - '0');
+    return n;
+}
+
+static int format_args(struct fmt_out *out, const char *fmt,
+                       struct fmt_args *args)
+{
+    for (;;) {
+        const char   *pct = strchr(fmt, '%');
+        struct spec   sp  = {0, 0, -1};
+        unsigned long n;
+        int           longs = 0;
+        char          c;
+
+        if (!pct) {
+            emit(out, fmt, strlen(fmt));
+            break;
+        }
+        emit(out, fmt, ( size_t )(pct - fmt));
+        fmt = pct + 1;
+
+        for (;; ++fmt) {
+            if (*fmt == '-')
+                sp.flags |= FLAG_LEFT;
+            else if (*fmt == '0')
+                sp.flags |= FLAG_ZERO;
+            else if (*fmt == '+')
+                sp.flags |= FLAG_PLUS;
+            else if (*fmt == ' ')
+                sp.flags |= FLAG_SPACE;
+            else if (*fmt == '#')
+                sp.flags |= FLAG_ALT;
+            else
+                break;
+        }
+
+        if (*fmt == '*') {
+            int w = ( int )arg_int(args);
+            fmt++;
+            if (w < 0) {
+                sp.flags |= FLAG_LEFT;
+                w         = -w;
+            }
+            sp.width = ( size_t )w;
+        } else {
+            sp.width = parse_num(&fmt);
+        }
+
+        if (*fmt == '.') {
+            fmt++;
+            if (*fmt == '*') {
+                fmt++;
+                sp.precision = ( int )arg_int(args);
+                if (sp.precision < 0)
+                    sp.precision = -1;
+            } else {
+                sp.precision = ( int )parse_num(&fmt);
+            }
+        }
+
+        /* l, ll and z are all 64 bits wide here, h and hh are promoted */
+        for (;; ++fmt) {
+            if (*fmt == 'l' || *fmt == 'z' || *fmt == 'j' || *fmt == 't')
+                longs++;
+            else if (*fmt != 'h')
+                break;
+        }
+
+        c = *fmt;
+        /* A bare %l predates the length modifiers and means %ld */
+        if (longs && !strchr("diuxXobp", c ? c : '%'))
+            c = 'd';
+        else if (c)
+            fmt++;
+
+        switch (c) {
+        case 'd':
+        case 'i': {
+            long v = longs ? arg_long(args) : arg_int(args);
+            n      = v < 0 ? 0ul - ( unsigned long )v : ( unsigned long )v;
+            emit_int(out, &sp, n, v < 0, 10, false);
+            break;
+        }
+
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'b':
+            n         = longs ? arg_ulong(args) : arg_uint(args);
+            sp.flags &= ~(FLAG_PLUS | FLAG_SPACE); /* Signed only */
+            emit_int(out, &sp, n, false,
+                     c == 'u' ? 10 : c == 'o' ? 8 : c == 'b' ? 2 : 16,
+                     c == 'X');
+            break;
+
+        case 'p':
+            n         = ( unsigned long )( uintptr_t )arg_ptr(args);
+            sp.flags &= ~(FLAG_PLUS | FLAG_SPACE);
+            sp.flags |= FLAG_ALT;
+            emit_int(out, &sp, n, false, 16, false);
+            break;
+
+        case 'c': {
+            char ch = ( char )arg_int(args);
+            emit_field(out, &sp, NULL, 0, 0, &ch, 1);
+            break;
+        }
+
+        case 's': {
+            const char *s = ( const char * )arg_ptr(args);
+            size_t      len;
+            if (!s)
+                s = "(null)";
+            len = sp.precision >= 0 ? strnlen(s, ( size_t )sp.precision)
+                                    : strlen(s);
+            emit_field(out, &sp, NULL, 0, 0, s, len);
+            break;
+        }
+
+        case '%':
+            emit(out, "%", 1);
+            break;
+
+        case '\0':
+            /* A lone % at the end of the format */
+            emit(out, "%", 1);
+            break;
+
+        default:
+            /* Unknown conversions are printed as written */
+            emit(out, pct, ( size_t )(fmt - pct));
+            break;
+        }
+        if (!*fmt)
+            break;
+    }
+
+    if (out->flush && out->len) {
+        out->flush(out->buf, out->len);
+        out->len = 0;
+    }
+    return out->total > INT_MAX ? -1 : ( int )out->total;
+}
+
+int format(struct fmt_out *out, const char *fmt, va_list ap)
+{
+    struct fmt_args args;
+    int             ret;
+
+    va_copy(args.ap, ap);
+    args.words  = NULL;
+    args.nwords = 0;
+    ret         = format_args(out, fmt, &args);
+    va_end(args.ap);
+    return ret;
+}
+
+int format_words(struct fmt_out *out, const char *fmt,
+                 const unsigned long *words, size_t nwords)
+{
+    struct fmt_args args;
+
+    args.words  = words;
+    args.nwords = nwords;
+    return format_args(out, fmt, &args);
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,61 @@
+/* format.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LIBK_FORMAT_H
+#define _LIBK_FORMAT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+/* Where format() puts its output. Text collects in `buf` and is handed to
+ * `flush` as one span whenever the buffer fills and once at the end, so a
+ * device sees a single write per printf() call unless the output outgrows
+ * the buffer. Without a `flush` the output is truncated to fit, which is how
+ * vsnprintf() uses it. */
+struct fmt_out {
+    char  *buf;
+    size_t size;  /* Capacity of buf */
+    size_t len;   /* Bytes waiting in buf */
+    size_t total; /* Bytes produced, including any truncated */
+    void (*flush)(const char *data, size_t size);
+};
+
+/* Format `ap` per `fmt` into `out` and return the number of bytes produced,
+ * or -1 if that does not fit in an int. Flushes any remainder. */
+int format(struct fmt_out *out, const char *fmt, va_list ap);
+
+/* format() with the arguments taken from `words`, one per conversion (and per
+ * `*`), as trace records store them. Strings are read when formatting. */
+int format_words(struct fmt_out *out, const char *fmt,
+                 const unsigned long *words, size_t nwords);
+
+#endif /* _LIBK_FORMAT_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,196 @@
+/* klog.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/klog.h>
+#include <sys/numconv.h>
+
+#define KLOG_MASK (KLOG_SLOTS - 1)
+#define DRAIN_BUF 512
+
+_Static_assert((KLOG_SLOTS & KLOG_MASK) == 0, "KLOG_SLOTS is a power of two");
+_Static_assert(sizeof(struct klog_record) == 128, "records are two lines");
+
+static struct klog_record klog_ring[KLOG_SLOTS] __attribute__((aligned(64)));
+static uint64_t           klog_head;    /* Next position to reserve */
+static struct klog_reader klog_default; /* For klog_drain() and klog_dump() */
+
+/* Each record is published seqlock style: its seq is zeroed before the text
+ * changes and set to the position + 1 once the text is complete, so a drain
+ * can tell committed, in-progress and overwritten records apart without
+ * locking out writers. A write larger than one record reserves all of its
+ * records with the same add so they stay contiguous. */
+void klog_write(const char *data, size_t size)
+{
+    uint64_t pos, tsc;
+    uint16_t flags = 0;
+
+    if (!size)
+        return;
+    pos = __atomic_fetch_add(&klog_head, (size + KLOG_TEXT - 1) / KLOG_TEXT,
+                             __ATOMIC_RELAXED);
+    tsc = __builtin_ia32_rdtsc();
+
+    for (; size; ++pos, flags = KLOG_CONT) {
+        struct klog_record *rec = &klog_ring[pos & KLOG_MASK];
+        size_t              n   = size < KLOG_TEXT ? size : KLOG_TEXT;
+
+        __atomic_store_n(&rec->seq, 0, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        rec->tsc   = tsc;
+        rec->len   = ( uint16_t )n;
+        rec->flags = flags;
+        memcpy(rec->text, data, n);
+        __atomic_store_n(&rec->seq, pos + 1, __ATOMIC_RELEASE);
+
+        data += n;
+        size -= n;
+    }
+}
+
+/* Records are gathered into one buffer so the device sees long spans */
+struct drain {
+    void (*write)(const char *data, size_t size);
+    size_t len;
+    char   buf[DRAIN_BUF];
+};
+
+static void drain_put(struct drain *d, const char *data, size_t size)
+{
+    if (d->len + size > sizeof(d->buf)) {
+        d->write(d->buf, d->len);
+        d->len = 0;
+    }
+    memcpy(d->buf + d->len, data, size);
+    d->len += size;
+}
+
+static void drain_lost(struct drain *d, uint64_t lost)
+{
+    char   msg[48] = "[klog] ";
+    size_t len     = 7;
+
+    len += utostr(msg + len, lost, 10);
+    memcpy(msg + len, " records lost\n", 14);
+    drain_put(d, msg, len + 14);
+}
+
+static size_t drain(struct klog_reader *r,
+                    void (*write)(const char *data, size_t size), bool panic)
+{
+    struct drain       d;
+    struct klog_record rec;
+    uint64_t           head  = __atomic_load_n(&klog_head, __ATOMIC_ACQUIRE);
+    uint64_t           tail  = r->tail;
+    uint64_t           lost  = 0;
+    size_t             count = 0;
+
+    d.write = write;
+    d.len   = 0;
+
+    /* Lapped, everything older than one ring behind head is gone */
+    if (head - tail > KLOG_SLOTS) {
+        lost = head - KLOG_SLOTS - tail;
+        tail = head - KLOG_SLOTS;
+    }
+
+    for (; tail != head; ++tail) {
+        struct klog_record *slot = &klog_ring[tail & KLOG_MASK];
+        uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+
+        if (seq == tail + 1) {
+            memcpy(&rec, slot, sizeof(rec));
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq) {
+                if (lost) {
+                    drain_lost(&d, lost);
+                    lost = 0;
+                }
+                drain_put(&d, rec.text, rec.len);
+                count++;
+                continue;
+            }
+            seq = tail + 2; /* Rewritten while being copied */
+        }
+        /* A later lap has the slot, or it is still being written. The
+         * second case waits for the next drain unless we are panicking. */
+        if (seq <= tail && !panic)
+            break;
+        lost++;
+    }
+
+    if (lost)
+        drain_lost(&d, lost);
+    if (d.len)
+        write(d.buf, d.len);
+    r->tail = tail;
+    return count;
+}
+
+void klog_reader_init(struct klog_reader *r)
+{
+    uint64_t head = __atomic_load_n(&klog_head, __ATOMIC_ACQUIRE);
+
+    r->tail = head > KLOG_SLOTS ? head - KLOG_SLOTS : 0;
+    r->busy = 0;
+}
+
+size_t klog_drain_from(struct klog_reader *r,
+                       void (*write)(const char *data, size_t size))
+{
+    size_t count;
+
+    if (__atomic_exchange_n(&r->busy, 1, __ATOMIC_ACQUIRE))
+        return 0;
+    count = drain(r, write, false);
+    __atomic_store_n(&r->busy, 0, __ATOMIC_RELEASE);
+    return count;
+}
+
+size_t klog_dump_from(struct klog_reader *r,
+                      void (*write)(const char *data, size_t size))
+{
+    return drain(r, write, true);
+}
+
+size_t klog_drain(void (*write)(const char *data, size_t size))
+{
+    return klog_drain_from(&klog_default, write);
+}
+
+size_t klog_dump(void (*write)(const char *data, size_t size))
+{
+    return klog_dump_from(&klog_default, write);
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
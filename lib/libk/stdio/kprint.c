@@ -0,0 +1,109 @@
+/* kprint.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/klog.h>
+#include <sys/kprint.h>
+#include <sys/numconv.h>
+
+/* Room for one conversion plus the terminator utostr() writes: a sign and 20
+ * decimal digits, or hex digits with their padding */
+#define KPRINT_NUM 24
+
+static char *kprint_room(struct kprint_buf *kp, size_t len)
+{
+    if (kp->len + len > sizeof(kp->buf))
+        kprint_flush(kp);
+    return kp->buf + kp->len;
+}
+
+void kprint_span(struct kprint_buf *kp, const char *str, size_t len)
+{
+    if (len > sizeof(kp->buf)) {
+        kprint_flush(kp);
+        klog_write(str, len);
+        return;
+    }
+    memcpy(kprint_room(kp, len), str, len);
+    kp->len += len;
+}
+
+void kprint_ulong(struct kprint_buf *kp, unsigned long val)
+{
+    kp->len += utostr(kprint_room(kp, KPRINT_NUM), val, 10);
+}
+
+void kprint_long(struct kprint_buf *kp, long val)
+{
+    char *dst = kprint_room(kp, KPRINT_NUM);
+
+    if (val < 0) {
+        *dst++ = '-';
+        kp->len++;
+    }
+    kp->len += utostr(dst, val < 0 ? 0ul - ( unsigned long )val
+                                   : ( unsigned long )val,
+                      10);
+}
+
+void kprint_hex(struct kprint_buf *kp, struct kprint_hex val)
+{
+    char  *dst    = kprint_room(kp, KPRINT_NUM);
+    size_t digits = num_digits(val.value, 16);
+    size_t pad    = val.width > digits ? val.width - digits : 0;
+
+    if (pad > KPRINT_NUM - 1 - digits)
+        pad = KPRINT_NUM - 1 - digits;
+    memset(dst, '0', pad);
+    kp->len += pad + utostr(dst + pad, val.value, 16);
+}
+
+void kprint_char(struct kprint_buf *kp, char val)
+{
+    *kprint_room(kp, 1) = val;
+    kp->len++;
+}
+
+void kprint_ptr(struct kprint_buf *kp, const void *val)
+{
+    kprint_span(kp, "0x", 2);
+    kprint_hex(kp, kp_hex(( uintptr_t )val));
+}
+
+void kprint_flush(struct kprint_buf *kp)
+{
+    if (kp->len)
+        klog_write(kp->buf, kp->len);
+    kp->len = 0;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
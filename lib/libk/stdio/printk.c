@@ -28,206 +28,33 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <limits.h>
-#include <stdbool.h>
 #include <stdarg.h>
 #include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
+#include <sys/klog.h>
 
-static bool print(const char *data, size_t length)
+#include "format.h"
+
+/* Enough for any one line of the boot log. Longer output is appended to the
+ * log each time the buffer fills. The consoles pick it up from the log, see
+ * klog_drain(). */
+#define PRINTF_BUF 256
+
+int vprintf(const char *restrict fmt, va_list ap)
 {
-    const unsigned char *bytes = ( const unsigned char * )data;
-    for (size_t i = 0; i < length; i++)
-        if (putchar(bytes[i]) == EOF)
-            return false;
-    return true;
+    char           buf[PRINTF_BUF];
+    struct fmt_out out = {buf, sizeof(buf), 0, 0, klog_write};
+    return format(&out, fmt, ap);
 }
 
-int printf(const char *restrict format, ...)
+int printf(const char *restrict fmt, ...)
 {
-    va_list parameters;
-    va_start(parameters, format);
-
-    int written = 0;
-
-    while (*format != '\0') {
-        size_t maxrem  = INT_MAX - written;
-        size_t padding = 4;
-        char   pad     = '0';
-
-        char percent   = '%'; /* Avoid .rodata.printf access */
-        if (format[0] != percent || format[1] == percent) {
-            if (format[0] == percent)
-                format++;
-            size_t amount = 1;
-            while (format[amount] && format[amount] != percent) {
-                amount++;
-            }
-
-            if (maxrem < amount) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(format, amount))
-                return -1;
-            format  += amount;
-            written += amount;
-            continue;
-        }
-
-        const char *format_begun_at = format++;
-
-        if (*format == 'c') {
-            format++;
-            char c = ( char )va_arg(parameters, int /* char promotes to int */);
-            if (!maxrem) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(&c, sizeof(c)))
-                return -1;
-            written++;
-        }
-
-        else if (*format == 's') {
-            format++;
-            const char *str = va_arg(parameters, const char *);
-            size_t      len = strlen(str);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(str, len))
-                return -1;
-            written += len;
-        }
-
-        else if (*format == percent) {
-            format++;
-            if (!maxrem) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(&percent, sizeof(percent)))
-                return -1;
-            written++;
-        }
-
-        else if (*format == 'd') {
-            format++;
-            int  n                    = va_arg(parameters, int);
-            char buf[sizeof(int) * 8] = {0};
-            itoa(n, ( char * )buf, 10);
-            size_t len = strlen(buf);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(buf, len))
-                return -1;
-            written += len;
-        }
-
-        else if (*format == 'l') {
-            format++;
-            long n                     = va_arg(parameters, long);
-            char buf[sizeof(long) * 8] = {0};
-            ltoa(n, ( char * )buf, 10);
-            size_t len = strlen(buf);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(buf, len))
-                return -1;
-            written += len;
-        }
-
-        else if (*format == 'u') {
-            format++;
-            unsigned int n = va_arg(parameters, unsigned int);
-            char         buf[sizeof(unsigned int) * 8] = {0};
-            itoa(n, ( char * )buf, 10);
-            size_t len = strlen(buf);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(buf, len))
-                return -1;
-            written += len;
-        }
-
-        else if (*format == 'o') {
-            format++;
-            int  n                    = va_arg(parameters, int);
-            char buf[sizeof(int) * 8] = {0};
-            itoa(n, ( char * )buf, 8);
-            size_t len = strlen(buf);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(buf, len))
-                return -1;
-            written += len;
-        }
-
-        else if (*format == 'b') {
-            format++;
-            int  n                    = va_arg(parameters, int);
-            char buf[sizeof(int) * 8] = {0};
-            itoa(n, ( char * )buf, 2);
-            size_t len = strlen(buf);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            for (size_t i = 0; i < len % padding; ++i)
-                if (!print(&pad, 1))
-                    return -1;
-            if (!print(buf, len))
-                return -1;
-            len     += len % padding;
-            written += len;
-        }
-
-        else if (*format == 'x') {
-            format++;
-            int  n                    = va_arg(parameters, int);
-            char buf[sizeof(int) * 8] = {0};
-            itoa(n, ( char * )buf, 16);
-            size_t len = strlen(buf);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            for (size_t i = 0; i < len % padding; ++i)
-                if (!print(&pad, 1))
-                    return -1;
-            if (!print(buf, len))
-                return -1;
-            len     += len % padding;
-            written += len;
-        }
-
-        else {
-            format     = format_begun_at;
-            size_t len = strlen(format);
-            if (maxrem < len) {
-                // TODO: Set errno to EOVERFLOW.
-                return -1;
-            }
-            if (!print(format, len))
-                return -1;
-            written += len;
-            format  += len;
-        }
-    }
+    va_list ap;
+    int     ret;
 
-    va_end(parameters);
-    return written;
+    va_start(ap, fmt);
+    ret = vprintf(fmt, ap);
+    va_end(ap);
+    return ret;
 }
 
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -29,13 +29,12 @@
  */
 
 #include <stdio.h>
-
-#include <kernel/vga.h>
+#include <sys/console.h>
 
 int putchar(int c)
 {
     char ch = ( char )c;
-    vga_putchar(ch);
+    console_write(&ch, 1);
     return c;
 }
 
@@ -30,11 +30,12 @@
 
 #include <stdio.h>
 
-#include <kernel/vga.h>
+#include <string.h>
+#include <sys/console.h>
 
 int puts(const char *str)
 {
-    vga_writes(str);
+    console_write(str, strlen(str));
     return 1;
 }
 
@@ -0,0 +1,167 @@
+/* trace.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/numconv.h>
+#include <sys/trace.h>
+
+#include "format.h"
+
+#define TRACE_MASK (TRACE_SLOTS - 1)
+#define DUMP_BUF   256
+
+_Static_assert((TRACE_SLOTS & TRACE_MASK) == 0, "TRACE_SLOTS is a power of 2");
+_Static_assert(sizeof(struct trace_record) == 64, "records are one line");
+
+struct trace_ring {
+    struct trace_record slots[TRACE_SLOTS];
+    uint64_t            head; /* Next position to reserve */
+    uint64_t            tail; /* Next position to dump */
+} __attribute__((aligned(64)));
+
+static struct trace_ring trace_rings[TRACE_CPUS];
+
+/* No per-CPU data yet, everything runs on the boot CPU */
+static inline unsigned trace_cpu(void) { return 0; }
+
+/* The writer owns its CPU's ring, the atomic add only has to hold up against
+ * an interrupt tracing on top of it. The format pointer doubles as the
+ * commit flag, see trace_read(). */
+void trace_write(const char *fmt, size_t nargs, const unsigned long *args)
+{
+    unsigned             cpu  = trace_cpu();
+    struct trace_ring   *ring = &trace_rings[cpu];
+    uint64_t             pos  = __atomic_fetch_add(&ring->head, 1,
+                                                   __ATOMIC_RELAXED);
+    struct trace_record *rec  = &ring->slots[pos & TRACE_MASK];
+
+    if (nargs > TRACE_ARGS)
+        nargs = TRACE_ARGS;
+
+    __atomic_store_n(&rec->fmt, NULL, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    rec->tsc   = __builtin_ia32_rdtsc();
+    rec->pos   = ( uint32_t )pos;
+    rec->cpu   = ( uint16_t )cpu;
+    rec->nargs = ( uint16_t )nargs;
+    for (size_t i = 0; i < nargs; ++i)
+        rec->args[i] = args[i];
+    __atomic_store_n(&rec->fmt, fmt, __ATOMIC_RELEASE);
+}
+
+enum trace_state { TRACE_OK, TRACE_BUSY, TRACE_GONE };
+
+/* Copy the record at `pos`. It may still be being written, or a later lap
+ * may have taken the slot, possibly while it was being copied. */
+static enum trace_state trace_read(struct trace_ring *ring, uint64_t pos,
+                                   struct trace_record *out)
+{
+    struct trace_record *rec = &ring->slots[pos & TRACE_MASK];
+    const char          *fmt = __atomic_load_n(&rec->fmt, __ATOMIC_ACQUIRE);
+
+    if (fmt) {
+        memcpy(out, rec, sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&rec->fmt, __ATOMIC_RELAXED) == fmt &&
+            out->pos == ( uint32_t )pos)
+            return TRACE_OK;
+    }
+    return ( int32_t )(__atomic_load_n(&rec->pos, __ATOMIC_RELAXED) -
+                       ( uint32_t )pos) > 0
+                   ? TRACE_GONE
+                   : TRACE_BUSY;
+}
+
+/* Load the oldest record of a ring still there, false if there is none */
+static bool trace_next(struct trace_ring *ring, struct trace_record *out)
+{
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (head - ring->tail > TRACE_SLOTS)
+        ring->tail = head - TRACE_SLOTS;
+    for (; ring->tail != head; ring->tail++) {
+        enum trace_state st = trace_read(ring, ring->tail, out);
+        if (st != TRACE_GONE)
+            return st == TRACE_OK;
+    }
+    return false;
+}
+
+/* "[tsc] cpuN: text\n", cut short to fit the buffer */
+static size_t trace_line(char *buf, size_t size,
+                         const struct trace_record *rec)
+{
+    struct fmt_out out = {buf, size - 1, 0, 0, NULL}; /* Room for a \n */
+
+    buf[out.len++]  = '[';
+    out.len        += utostr(buf + out.len, rec->tsc, 10);
+    memcpy(buf + out.len, "] cpu", 5);
+    out.len        += 5;
+    out.len        += utostr(buf + out.len, rec->cpu, 10);
+    buf[out.len++]  = ':';
+    buf[out.len++]  = ' ';
+
+    format_words(&out, rec->fmt, rec->args, rec->nargs);
+    if (buf[out.len - 1] != '\n')
+        buf[out.len++] = '\n';
+    return out.len;
+}
+
+size_t trace_dump(void (*write)(const char *data, size_t size))
+{
+    char                buf[DUMP_BUF];
+    struct trace_record rec[TRACE_CPUS];
+    bool                have[TRACE_CPUS];
+    size_t              count = 0;
+
+    for (unsigned c = 0; c < TRACE_CPUS; ++c)
+        have[c] = trace_next(&trace_rings[c], &rec[c]);
+
+    /* Merge the rings by time stamp */
+    for (;;) {
+        int best = -1;
+        for (unsigned c = 0; c < TRACE_CPUS; ++c)
+            if (have[c] && (best < 0 || rec[c].tsc < rec[best].tsc))
+                best = ( int )c;
+        if (best < 0)
+            break;
+
+        write(buf, trace_line(buf, sizeof(buf), &rec[best]));
+        count++;
+        trace_rings[best].tail++;
+        have[best] = trace_next(&trace_rings[best], &rec[best]);
+    }
+    return count;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
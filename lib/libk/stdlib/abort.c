@@ -30,10 +30,13 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/console.h>
 
 __attribute__((__noreturn__)) void abort(void)
 {
     printf("[kernel]: panic: abort()\n");
+    /* Whatever each console has not shown yet goes out now */
+    console_dump();
     asm volatile("hlt");
     while (1) {
     }
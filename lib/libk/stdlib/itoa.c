@@ -29,32 +29,24 @@
  */
 
 #include <stdlib.h>
+#include <sys/numconv.h>
 
+/* Decimal is signed. Other bases print the two's complement bit pattern, as
+ * printf's %x and %o do. */
 char *itoa(int n, char *str, int base)
 {
-    int i          = 0;
-    int isNegative = 0;
-
-    if (n == 0) {
-        str[i++] = '0';
-        str[i]   = '\0';
-        return str;
-    }
     if (n < 0 && base == 10) {
-        isNegative = 1;
-        n          = -n;
-    }
-    while (n != 0) {
-        int rem  = n % base;
-        str[i++] = (rem > 9) ? (rem - 10) + 'a' : rem + '0';
-        div_t dt = div(n, base);
-        n        = dt.quot;
+        *str = '-';
+        utostr(str + 1, 0u - ( unsigned int )n, 10);
+        return str;
     }
-    if (isNegative)
-        str[i++] = '-';
-    str[i] = '\0';
-    reverse(str, i);
+    utostr(str, ( unsigned int )n, ( unsigned )base);
+    return str;
+}
 
+char *utoa(unsigned int n, char *str, int base)
+{
+    utostr(str, n, ( unsigned )base);
     return str;
 }
 
@@ -29,32 +29,24 @@
  */
 
 #include <stdlib.h>
+#include <sys/numconv.h>
 
+/* Decimal is signed. Other bases print the two's complement bit pattern, as
+ * printf's %lx and %lo do. */
 char *ltoa(long n, char *str, int base)
 {
-    long i          = 0;
-    int  isNegative = FALSE;
-
-    if (n == 0) {
-        str[i++] = '0';
-        str[i]   = '\0';
-        return str;
-    }
     if (n < 0 && base == 10) {
-        isNegative = TRUE;
-        n          = -n;
-    }
-    while (n != 0) {
-        int rem   = n % base;
-        str[i++]  = (rem > 9) ? (rem - 10) + 'a' : rem + '0';
-        ldiv_t dt = ldiv(n, base);
-        n         = dt.quot;
+        *str = '-';
+        utostr(str + 1, 0ul - ( unsigned long )n, 10);
+        return str;
     }
-    if (isNegative)
-        str[i++] = '-';
-    str[i] = '\0';
-    reverse(str, i);
+    utostr(str, ( unsigned long )n, ( unsigned )base);
+    return str;
+}
 
+char *ultoa(unsigned long n, char *str, int base)
+{
+    utostr(str, n, ( unsigned )base);
     return str;
 }
 
@@ -0,0 +1,150 @@
+/* numconv.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/numconv.h>
+
+static const char digit_chars[36] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/* "00" to "99", so decimal conversion retires two digits per step */
+static const char digit_pairs[200] = "00010203040506070809"
+                                     "10111213141516171819"
+                                     "20212223242526272829"
+                                     "30313233343536373839"
+                                     "40414243444546474849"
+                                     "50515253545556575859"
+                                     "60616263646566676869"
+                                     "70717273747576777879"
+                                     "80818283848586878889"
+                                     "90919293949596979899";
+
+/* One division per four digits, and the division is by a constant so the
+ * compiler turns it into a multiply by the reciprocal */
+static size_t dec_digits(uint64_t n)
+{
+    size_t d = 1;
+    for (;;) {
+        if (n < 10)
+            return d;
+        if (n < 100)
+            return d + 1;
+        if (n < 1000)
+            return d + 2;
+        if (n < 10000)
+            return d + 3;
+        n /= 10000;
+        d += 4;
+    }
+}
+
+/* Write `n` in decimal so that its last digit lands just before `end`. The
+ * divisions by 100 become multiplies, and the loop drops to 32-bit arithmetic
+ * (a cheaper multiply) as soon as the value fits. */
+static void put_dec(char *end, uint64_t n)
+{
+    uint32_t m;
+
+    while (n > UINT32_MAX) {
+        uint64_t q = n / 100;
+        uint32_t r = ( uint32_t )(n - q * 100) * 2;
+        *--end     = digit_pairs[r + 1];
+        *--end     = digit_pairs[r];
+        n          = q;
+    }
+    m = ( uint32_t )n;
+    while (m >= 100) {
+        uint32_t q = m / 100;
+        uint32_t r = (m - q * 100) * 2;
+        *--end     = digit_pairs[r + 1];
+        *--end     = digit_pairs[r];
+        m          = q;
+    }
+    if (m >= 10) {
+        *--end = digit_pairs[m * 2 + 1];
+        *--end = digit_pairs[m * 2];
+    } else {
+        *--end = ( char )('0' + m);
+    }
+}
+
+static int is_pow2(unsigned base) { return (base & (base - 1)) == 0; }
+
+size_t num_digits(unsigned long n, unsigned base)
+{
+    size_t d = 1;
+
+    if (base == 10)
+        return dec_digits(n);
+    if (is_pow2(base)) {
+        unsigned shift = ( unsigned )__builtin_ctz(base);
+        unsigned bits  = 64 - ( unsigned )__builtin_clzl(n | 1);
+        return (bits + shift - 1) / shift;
+    }
+    while (n >= base) {
+        n /= base;
+        d++;
+    }
+    return d;
+}
+
+size_t utostr(char *str, unsigned long n, unsigned base)
+{
+    size_t len;
+    char  *end;
+
+    if (base < 2 || base > 36) {
+        *str = '\0';
+        return 0;
+    }
+
+    len  = num_digits(n, base);
+    end  = str + len;
+    *end = '\0';
+
+    if (base == 10) {
+        put_dec(end, n);
+    } else if (is_pow2(base)) {
+        unsigned shift = ( unsigned )__builtin_ctz(base);
+        unsigned mask  = base - 1;
+        do {
+            *--end  = digit_chars[n & mask];
+            n     >>= shift;
+        } while (n);
+    } else {
+        do {
+            *--end  = digit_chars[n % base];
+            n      /= base;
+        } while (n);
+    }
+    return len;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
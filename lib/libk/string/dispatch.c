@@ -0,0 +1,120 @@
+/* dispatch.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <limits.h>
+#include <string.h>
+#include <sys/dispatch.h>
+
+#include <kernel/x86/cpu.h>
+
+/* Fills and copies at or above these sizes are handed to `rep stosb` and
+ * `rep movsb` on parts with ERMS. The microcoded path streams whole cache
+ * lines and overtakes the SSE2 loops past 2 KiB and the AVX2 loops past
+ * 4 KiB; `make -C lib bench` prints the crossover for the host it runs on.
+ * FSRM only speeds up moves shorter than the vector tiers already handle,
+ * so it does not move the thresholds. */
+#ifndef ERMS_THRESHOLD_SSE2
+#define ERMS_THRESHOLD_SSE2 2048
+#endif
+
+#ifndef ERMS_THRESHOLD_AVX2
+#define ERMS_THRESHOLD_AVX2 4096
+#endif
+
+/* `rep` string instructions are left off until ERMS has been seen */
+struct libk_ops libk_ops = {
+        .memcpy          = memcpy_sse2,
+        .memset          = memset_sse2,
+        .memcmp          = memcmp_sse2,
+        .strlen          = strlen_sse2,
+
+        .gfx_fill32         = gfx_fill32_sse2,
+        .gfx_copy32         = gfx_copy32_sse2,
+        .gfx_key32          = gfx_key32_sse2,
+        .gfx_blend32        = gfx_blend32_sse2,
+        .gfx_rgb888_to_xrgb = gfx_rgb888_to_xrgb_sse2,
+        .gfx_xrgb_to_rgb888 = gfx_xrgb_to_rgb888_sse2,
+        .gfx_rgb565_to_xrgb = gfx_rgb565_to_xrgb_sse2,
+        .gfx_xrgb_to_rgb565 = gfx_xrgb_to_rgb565_sse2,
+        .gfx_index8_to_xrgb = gfx_index8_to_xrgb_sse2,
+        .gfx_xrgb_to_index8 = gfx_xrgb_to_index8_sse2,
+
+        .movsb_threshold = UINTPTR_MAX,
+        .stosb_threshold = UINTPTR_MAX,
+};
+
+void libk_dispatch(uint32_t features)
+{
+    libk_ops.memcpy          = memcpy_sse2;
+    libk_ops.memset          = memset_sse2;
+    libk_ops.memcmp          = memcmp_sse2;
+    libk_ops.strlen          = strlen_sse2;
+
+    libk_ops.gfx_fill32         = gfx_fill32_sse2;
+    libk_ops.gfx_copy32         = gfx_copy32_sse2;
+    libk_ops.gfx_key32          = gfx_key32_sse2;
+    libk_ops.gfx_blend32        = gfx_blend32_sse2;
+    libk_ops.gfx_rgb888_to_xrgb = gfx_rgb888_to_xrgb_sse2;
+    libk_ops.gfx_xrgb_to_rgb888 = gfx_xrgb_to_rgb888_sse2;
+    libk_ops.gfx_rgb565_to_xrgb = gfx_rgb565_to_xrgb_sse2;
+    libk_ops.gfx_xrgb_to_rgb565 = gfx_xrgb_to_rgb565_sse2;
+    libk_ops.gfx_index8_to_xrgb = gfx_index8_to_xrgb_sse2;
+    libk_ops.gfx_xrgb_to_index8 = gfx_xrgb_to_index8_sse2;
+
+    libk_ops.movsb_threshold = UINTPTR_MAX;
+    libk_ops.stosb_threshold = UINTPTR_MAX;
+
+    if (features & CPU_FEATURE_AVX2) {
+        libk_ops.memcpy = memcpy_avx2;
+        libk_ops.memset = memset_avx2;
+        libk_ops.memcmp = memcmp_avx2;
+        libk_ops.strlen = strlen_avx2;
+
+        libk_ops.gfx_fill32         = gfx_fill32_avx2;
+        libk_ops.gfx_copy32         = gfx_copy32_avx2;
+        libk_ops.gfx_key32          = gfx_key32_avx2;
+        libk_ops.gfx_blend32        = gfx_blend32_avx2;
+        libk_ops.gfx_rgb888_to_xrgb = gfx_rgb888_to_xrgb_avx2;
+        libk_ops.gfx_xrgb_to_rgb888 = gfx_xrgb_to_rgb888_avx2;
+        libk_ops.gfx_rgb565_to_xrgb = gfx_rgb565_to_xrgb_avx2;
+        libk_ops.gfx_xrgb_to_rgb565 = gfx_xrgb_to_rgb565_avx2;
+        libk_ops.gfx_index8_to_xrgb = gfx_index8_to_xrgb_avx2;
+        libk_ops.gfx_xrgb_to_index8 = gfx_xrgb_to_index8_avx2;
+    }
+
+    if (features & CPU_FEATURE_ERMS) {
+        size_t threshold = (features & CPU_FEATURE_AVX2) ? ERMS_THRESHOLD_AVX2
+                                                         : ERMS_THRESHOLD_SSE2;
+        libk_ops.movsb_threshold = threshold;
+        libk_ops.stosb_threshold = threshold;
+    }
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -30,16 +30,127 @@
 
 #include <string.h>
 
-int memcmp(const void *dest, const void *src, size_t size)
+#include "memimpl.h"
+
+static __always_inline int byte_diff(const unsigned char *pa,
+                                     const unsigned char *pb, size_t i)
+{
+    return ( int )pa[i] - ( int )pb[i];
+}
+
+/* Below 16 bytes: first word and the (possibly overlapping) last word */
+static __always_inline int memcmp_small(const unsigned char *pa,
+                                        const unsigned char *pb, size_t size)
+{
+    size_t i = 0;
+
+    if (size >= 8) {
+        uint64_t a = ld64(pa), b = ld64(pb);
+        if (a != b)
+            return byte_diff(pa, pb, diff64(a, b));
+        i = size - 8;
+        a = ld64(pa + i);
+        b = ld64(pb + i);
+        if (a != b)
+            return byte_diff(pa, pb, i + diff64(a, b));
+        return 0;
+    }
+    for (; i < size; ++i)
+        if (pa[i] != pb[i])
+            return byte_diff(pa, pb, i);
+    return 0;
+}
+
+int memcmp_sse2(const void *dest, const void *src, size_t size)
+{
+    const unsigned char *pa = ( const unsigned char * )dest;
+    const unsigned char *pb = ( const unsigned char * )src;
+    const v16u8          z  = {0};
+    size_t               i  = 0;
+    unsigned             m;
+
+    if (size < 16)
+        return memcmp_small(pa, pb, size);
+
+    /* 64 bytes per iteration: the XOR differences are ORed together and
+     * tested once, the mismatching vector is only located on a miss */
+    for (; i + 64 <= size; i += 64) {
+        v16u8 x = (ld128(pa + i) ^ ld128(pb + i)) |
+                  (ld128(pa + i + 16) ^ ld128(pb + i + 16)) |
+                  (ld128(pa + i + 32) ^ ld128(pb + i + 32)) |
+                  (ld128(pa + i + 48) ^ ld128(pb + i + 48));
+        if (eqmask128(x, z) != 0xFFFF)
+            break;
+    }
+
+    /* Up to 63 bytes left (or a known mismatch), a vector at a time */
+    for (; i + 16 <= size; i += 16) {
+        m = eqmask128(ld128(pa + i), ld128(pb + i));
+        if (m != 0xFFFF)
+            return byte_diff(pa, pb, i + __builtin_ctz(~m));
+    }
+
+    /* Overlapping last vector for the remaining 1-15 bytes */
+    if (i < size) {
+        i = size - 16;
+        m = eqmask128(ld128(pa + i), ld128(pb + i));
+        if (m != 0xFFFF)
+            return byte_diff(pa, pb, i + __builtin_ctz(~m));
+    }
+
+    return 0;
+}
+
+__avx2 int memcmp_avx2(const void *dest, const void *src, size_t size)
 {
     const unsigned char *pa = ( const unsigned char * )dest;
     const unsigned char *pb = ( const unsigned char * )src;
-    for (size_t i = 0; i < size; i++) {
-        if (pa[i] != pb[i]) {
-            return ( int )(pa[i] - pb[i]);
-        }
+    const v32u8          z  = {0};
+    size_t               i  = 0;
+    unsigned             m;
+
+    if (size < 16)
+        return memcmp_small(pa, pb, size);
+
+    if (size <= 32) {
+        m = eqmask128(ld128(pa), ld128(pb));
+        if (m != 0xFFFF)
+            return byte_diff(pa, pb, __builtin_ctz(~m));
+        i = size - 16;
+        m = eqmask128(ld128(pa + i), ld128(pb + i));
+        if (m != 0xFFFF)
+            return byte_diff(pa, pb, i + __builtin_ctz(~m));
+        return 0;
+    }
+
+    for (; i + 128 <= size; i += 128) {
+        v32u8 x = (ld256(pa + i) ^ ld256(pb + i)) |
+                  (ld256(pa + i + 32) ^ ld256(pb + i + 32)) |
+                  (ld256(pa + i + 64) ^ ld256(pb + i + 64)) |
+                  (ld256(pa + i + 96) ^ ld256(pb + i + 96));
+        if (eqmask256(x, z) != 0xFFFFFFFF)
+            break;
     }
+
+    for (; i + 32 <= size; i += 32) {
+        m = eqmask256(ld256(pa + i), ld256(pb + i));
+        if (m != 0xFFFFFFFF)
+            return byte_diff(pa, pb, i + __builtin_ctz(~m));
+    }
+
+    if (i < size) {
+        i = size - 32;
+        m = eqmask256(ld256(pa + i), ld256(pb + i));
+        if (m != 0xFFFFFFFF)
+            return byte_diff(pa, pb, i + __builtin_ctz(~m));
+    }
+
     return 0;
 }
 
+int memcmp(const void *dest, const void *src, size_t size)
+{
+    return libk_ops.memcmp(dest, src, size);
+}
+
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,158 @@
+/* memcpy.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "memimpl.h"
+
+/* Copies of up to 32 bytes, everything is loaded before anything is stored */
+static __always_inline void memcpy_small(unsigned char       *d,
+                                         const unsigned char *s, size_t size)
+{
+    if (size > 16) {
+        v16u8 a = ld128(s), b = ld128(s + size - 16);
+        st128(d, a);
+        st128(d + size - 16, b);
+    } else if (size >= 8) {
+        uint64_t a = ld64(s), b = ld64(s + size - 8);
+        st64(d, a);
+        st64(d + size - 8, b);
+    } else if (size >= 4) {
+        uint32_t a = ld32(s), b = ld32(s + size - 4);
+        st32(d, a);
+        st32(d + size - 4, b);
+    } else if (size >= 2) {
+        uint16_t a = ld16(s), b = ld16(s + size - 2);
+        st16(d, a);
+        st16(d + size - 2, b);
+    } else if (size) {
+        *d = *s;
+    }
+}
+
+/* Every tier loads its head and tail before storing anything and the body
+ * only ever stores below the bytes it has yet to load. That makes these
+ * copies safe for overlapping buffers as long as dest <= src, which memmove
+ * relies on for its forward direction. */
+void *memcpy_sse2(void *dest, const void *src, size_t size)
+{
+    unsigned char       *d = ( unsigned char * )dest;
+    const unsigned char *s = ( const unsigned char * )src;
+
+    if (size <= 32) {
+        memcpy_small(d, s, size);
+        return dest;
+    }
+
+    if (size <= 64) {
+        v16u8 a = ld128(s), b = ld128(s + 16);
+        v16u8 c = ld128(s + size - 32), e = ld128(s + size - 16);
+        st128(d, a);
+        st128(d + 16, b);
+        st128(d + size - 32, c);
+        st128(d + size - 16, e);
+        return dest;
+    }
+
+    if (size >= libk_ops.movsb_threshold) {
+        rep_movsb(d, s, size);
+        return dest;
+    }
+
+    /* Unaligned head, 32-byte body with aligned stores, unaligned tail */
+    v16u8  head  = ld128(s);
+    v16u8  tail0 = ld128(s + size - 32);
+    v16u8  tail1 = ld128(s + size - 16);
+    size_t skew  = 16 - (( uintptr_t )d & 15);
+    size_t rem   = size - skew;
+
+    unsigned char       *dp = d + skew;
+    const unsigned char *sp = s + skew;
+    for (; rem > 32; rem -= 32, dp += 32, sp += 32) {
+        v16u8 a = ld128(sp), b = ld128(sp + 16);
+        *( v16u8 * )dp        = a;
+        *( v16u8 * )(dp + 16) = b;
+    }
+    st128(d + size - 32, tail0);
+    st128(d + size - 16, tail1);
+    st128(d, head);
+
+    return dest;
+}
+
+__avx2 void *memcpy_avx2(void *dest, const void *src, size_t size)
+{
+    unsigned char       *d = ( unsigned char * )dest;
+    const unsigned char *s = ( const unsigned char * )src;
+
+    if (size <= 32) {
+        memcpy_small(d, s, size);
+        return dest;
+    }
+
+    if (size <= 64) {
+        v32u8 a = ld256(s), b = ld256(s + size - 32);
+        st256(d, a);
+        st256(d + size - 32, b);
+        return dest;
+    }
+
+    if (size >= libk_ops.movsb_threshold) {
+        rep_movsb(d, s, size);
+        return dest;
+    }
+
+    /* Unaligned head, 64-byte body with aligned stores, unaligned tail */
+    v32u8  head  = ld256(s);
+    v32u8  tail0 = ld256(s + size - 64);
+    v32u8  tail1 = ld256(s + size - 32);
+    size_t skew  = 32 - (( uintptr_t )d & 31);
+    size_t rem   = size - skew;
+
+    unsigned char       *dp = d + skew;
+    const unsigned char *sp = s + skew;
+    for (; rem > 64; rem -= 64, dp += 64, sp += 64) {
+        v32u8 a = ld256(sp), b = ld256(sp + 32);
+        *( v32u8 * )dp        = a;
+        *( v32u8 * )(dp + 32) = b;
+    }
+    st256(d + size - 64, tail0);
+    st256(d + size - 32, tail1);
+    st256(d, head);
+
+    return dest;
+}
+
+void *memcpy(void *dest, const void *src, size_t size)
+{
+    return libk_ops.memcpy(dest, src, size);
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,66 @@
+/* memcpy_nt.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "memimpl.h"
+
+/* Copy with non-temporal stores, see memset_nt. The source is read through
+ * the cache as usual, only the destination is streamed. */
+void *memcpy_nt(void *dest, const void *src, size_t size)
+{
+    unsigned char       *d    = ( unsigned char * )dest;
+    const unsigned char *s    = ( const unsigned char * )src;
+    unsigned char       *end  = d + size;
+    size_t               head = (16 - (( uintptr_t )d & 15)) & 15;
+
+    if (size < 64)
+        return memcpy(dest, src, size);
+
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    for (; d + 64 <= end; d += 64, s += 64) {
+        v2di a = ( v2di )ld128(s), b = ( v2di )ld128(s + 16);
+        v2di c = ( v2di )ld128(s + 32), e = ( v2di )ld128(s + 48);
+        __builtin_ia32_movntdq(( v2di * )d, a);
+        __builtin_ia32_movntdq(( v2di * )(d + 16), b);
+        __builtin_ia32_movntdq(( v2di * )(d + 32), c);
+        __builtin_ia32_movntdq(( v2di * )(d + 48), e);
+    }
+    for (; d + 16 <= end; d += 16, s += 16)
+        __builtin_ia32_movntdq(( v2di * )d, ( v2di )ld128(s));
+    memcpy(d, s, end - d);
+    __builtin_ia32_sfence();
+
+    return dest;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,236 @@
+/* memimpl.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LIBK_MEMIMPL_H
+#define _LIBK_MEMIMPL_H
+
+#include <sys/cdefs.h>
+#include <sys/dispatch.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Shared helpers for the word and vector sized string routines. The unaligned
+ * typedefs let the compiler emit single mov/movdqu instructions for loads and
+ * stores at any address without tripping strict aliasing. */
+
+typedef uint16_t u16_u __attribute__((__aligned__(1), __may_alias__));
+typedef uint32_t u32_u __attribute__((__aligned__(1), __may_alias__));
+typedef uint64_t u64_u __attribute__((__aligned__(1), __may_alias__));
+typedef uint64_t u64_a __attribute__((__may_alias__));
+
+typedef char     v16qi __attribute__((__vector_size__(16), __may_alias__));
+typedef uint8_t  v16u8 __attribute__((__vector_size__(16), __may_alias__));
+typedef uint64_t v2u64 __attribute__((__vector_size__(16), __may_alias__));
+typedef long long v2di __attribute__((__vector_size__(16), __may_alias__));
+typedef uint8_t  v16u8_u
+        __attribute__((__vector_size__(16), __aligned__(1), __may_alias__));
+
+#define ONES64  _u(0x0101010101010101)
+#define HIGHS64 _u(0x8080808080808080)
+
+/* Replicate a byte into every lane of a 64-bit word */
+static __always_inline uint64_t bcast64(unsigned char c) { return ONES64 * c; }
+
+/* Replicate a byte into every lane of a 128-bit vector */
+static __always_inline v16u8 bcast128(unsigned char c)
+{
+    uint64_t w = bcast64(c);
+    return ( v16u8 )(( v2u64 ){w, w});
+}
+
+static __always_inline void st16(void *p, uint16_t v) { *( u16_u * )p = v; }
+static __always_inline void st32(void *p, uint32_t v) { *( u32_u * )p = v; }
+static __always_inline void st64(void *p, uint64_t v) { *( u64_u * )p = v; }
+static __always_inline void st128(void *p, v16u8 v) { *( v16u8_u * )p = v; }
+
+static __always_inline uint16_t ld16(const void *p)
+{
+    return *( const u16_u * )p;
+}
+
+static __always_inline uint32_t ld32(const void *p)
+{
+    return *( const u32_u * )p;
+}
+
+static __always_inline uint64_t ld64(const void *p)
+{
+    return *( const u64_u * )p;
+}
+
+static __always_inline v16u8 ld128(const void *p)
+{
+    return *( const v16u8_u * )p;
+}
+
+/* One bit per byte lane, set where the lanes of `a` and `b` are equal */
+static __always_inline unsigned eqmask128(v16u8 a, v16u8 b)
+{
+#if defined(__SSE2__)
+    return ( unsigned )__builtin_ia32_pmovmskb128(( v16qi )(a == b));
+#else
+    v16qi    eq = ( v16qi )(a == b);
+    unsigned m  = 0;
+    for (unsigned i = 0; i < 16; ++i)
+        m |= ( unsigned )(eq[i] & 1) << i;
+    return m;
+#endif
+}
+
+/* Offset of the first differing byte between two unequal 64-bit words */
+static __always_inline size_t diff64(uint64_t a, uint64_t b)
+{
+    return ( size_t )__builtin_ctzll(a ^ b) >> 3;
+}
+
+/* 256-bit variants, only callable from functions built with __avx2 and only
+ * reached at runtime once libk_dispatch() has seen CPU_FEATURE_AVX2 */
+#define __avx2 __attribute__((__target__("avx2")))
+
+typedef char    v32qi __attribute__((__vector_size__(32), __may_alias__));
+typedef uint8_t v32u8 __attribute__((__vector_size__(32), __may_alias__));
+typedef uint8_t v32u8_u
+        __attribute__((__vector_size__(32), __aligned__(1), __may_alias__));
+
+static __always_inline __avx2 v32u8 bcast256(unsigned char c)
+{
+    return ( v32u8 ){0} + c;
+}
+
+static __always_inline __avx2 v32u8 ld256(const void *p)
+{
+    return *( const v32u8_u * )p;
+}
+
+static __always_inline __avx2 void st256(void *p, v32u8 v)
+{
+    *( v32u8_u * )p = v;
+}
+
+static __always_inline __avx2 unsigned eqmask256(v32u8 a, v32u8 b)
+{
+    return ( unsigned )__builtin_ia32_pmovmskb256(( v32qi )(a == b));
+}
+
+/* Hand a fill or copy to the microcoded string instructions */
+static __always_inline void rep_stosb(void *p, int val, size_t len)
+{
+    __asm__ volatile("rep stosb" : "+D"(p), "+c"(len) : "a"(val) : "memory");
+}
+
+static __always_inline void rep_movsb(void *d, const void *s, size_t len)
+{
+    __asm__ volatile("rep movsb" : "+D"(d), "+S"(s), "+c"(len) : : "memory");
+}
+
+/* Byte scanning core shared by the str* and memchr routines. Blocks are read
+ * at SCAN_STRIDE alignment so a read never crosses into the next page, even
+ * when it runs past the end of the string. The scan_* helpers return a mask
+ * of matching bytes in the block at `p`, ignoring its first `off` bytes, and
+ * the first match sits at scan_index() of a non-zero mask. Kernels built
+ * with -mno-sse get the word-at-a-time has-zero-byte version. */
+#if defined(__SSE2__)
+
+#define SCAN_STRIDE 16
+
+typedef unsigned scanmask_t;
+
+static __always_inline scanmask_t scan_eq(const unsigned char *p,
+                                          unsigned char c, size_t off)
+{
+    return eqmask128(*( const v16u8 * )p, bcast128(c)) & (~0u << off);
+}
+
+/* Matches for either `c` or the terminating NUL */
+static __always_inline scanmask_t scan_eq_nul(const unsigned char *p,
+                                              unsigned char c, size_t off)
+{
+    v16u8 v = *( const v16u8 * )p;
+    return (eqmask128(v, bcast128(c)) | eqmask128(v, ( v16u8 ){0})) &
+           (~0u << off);
+}
+
+static __always_inline size_t scan_index(scanmask_t m)
+{
+    return ( size_t )__builtin_ctz(m);
+}
+
+#else /* !__SSE2__ */
+
+#define SCAN_STRIDE 8
+
+typedef uint64_t scanmask_t;
+
+/* High bit set in each zero byte of `x`. A borrow can set bits above the
+ * first zero byte too, so only the lowest set bit is meaningful. */
+static __always_inline uint64_t haszero64(uint64_t x)
+{
+    return (x - ONES64) & ~x & HIGHS64;
+}
+
+/* The skipped bytes are forced non-zero before the test rather than masked
+ * out after it, so they cannot borrow into the bytes that follow */
+static __always_inline uint64_t skipmask64(size_t off)
+{
+    return (( uint64_t )1 << (off * 8)) - 1;
+}
+
+static __always_inline scanmask_t scan_eq(const unsigned char *p,
+                                          unsigned char c, size_t off)
+{
+    uint64_t x = *( const u64_a * )p ^ bcast64(c);
+    return haszero64(x | skipmask64(off));
+}
+
+static __always_inline scanmask_t scan_eq_nul(const unsigned char *p,
+                                              unsigned char c, size_t off)
+{
+    uint64_t x = *( const u64_a * )p;
+    return haszero64((x ^ bcast64(c)) | skipmask64(off)) |
+           haszero64(x | skipmask64(off));
+}
+
+static __always_inline size_t scan_index(scanmask_t m)
+{
+    return ( size_t )__builtin_ctzll(m) >> 3;
+}
+
+#endif /* __SSE2__ */
+
+/* Round `p` down to the scan block holding it */
+static __always_inline const unsigned char *scan_block(const void *p)
+{
+    return ( const unsigned char * )(( uintptr_t )p &
+                                     ~( uintptr_t )(SCAN_STRIDE - 1));
+}
+
+#endif /* _LIBK_MEMIMPL_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -30,16 +30,43 @@
 
 #include <string.h>
 
+#include "memimpl.h"
+
 void *memmove(void *dst, const void *src, size_t size)
 {
-    unsigned char       *pd = ( unsigned char * )dst;
-    const unsigned char *ps = ( const unsigned char * )src;
-    if (pd < ps || pd >= ps + size)
-        for (size_t i = 0; i < size; ++i)
-            pd[i] = ps[i];
-    else
-        for (size_t i = size; i > 0; --i)
-            pd[i - 1] = ps[i - 1];
+    unsigned char       *d = ( unsigned char * )dst;
+    const unsigned char *s = ( const unsigned char * )src;
+
+    /* Disjoint buffers and dst below src are both safe to copy forwards */
+    if (( uintptr_t )d - ( uintptr_t )s >= size)
+        return memcpy(dst, src, size);
+
+    /* Up to 64 bytes memcpy loads everything before it stores anything */
+    if (size <= 64)
+        return memcpy(dst, src, size);
+
+    /* Backwards: aligned 32-byte stores from the end down, with the head and
+     * the unaligned tail loaded up front and stored last. `rep movsb` is left
+     * out here as backwards string moves (DF=1) run at byte speed. */
+    v16u8  head0 = ld128(s);
+    v16u8  head1 = ld128(s + 16);
+    v16u8  tail  = ld128(s + size - 16);
+    size_t skew  = ( uintptr_t )(d + size) & 15;
+    size_t rem   = size - skew;
+
+    unsigned char       *dp = d + rem;
+    const unsigned char *sp = s + rem;
+    for (; rem > 32; rem -= 32) {
+        dp -= 32;
+        sp -= 32;
+        v16u8 a = ld128(sp), b = ld128(sp + 16);
+        *( v16u8 * )dp        = a;
+        *( v16u8 * )(dp + 16) = b;
+    }
+    st128(d, head0);
+    st128(d + 16, head1);
+    st128(d + size - 16, tail);
+
     return dst;
 }
 
@@ -30,12 +30,112 @@
 
 #include <string.h>
 
-void *memset(void *mem, int val, size_t len)
+#include "memimpl.h"
+
+/* Fills below 16 bytes: two possibly overlapping stores cover any length */
+static __always_inline void memset_small(unsigned char *p, int val, size_t len)
 {
-    register size_t i;
-    for (i = 0; i < len; ++i)
-        (( char * )mem)[i] = val;
+    uint64_t w = bcast64(( unsigned char )val);
+
+    if (len >= 8) {
+        st64(p, w);
+        st64(p + len - 8, w);
+    } else if (len >= 4) {
+        st32(p, ( uint32_t )w);
+        st32(p + len - 4, ( uint32_t )w);
+    } else if (len >= 2) {
+        st16(p, ( uint16_t )w);
+        st16(p + len - 2, ( uint16_t )w);
+    } else if (len) {
+        *p = ( unsigned char )val;
+    }
+}
+
+void *memset_sse2(void *mem, int val, size_t len)
+{
+    unsigned char *p = ( unsigned char * )mem;
+    unsigned char *end, *q;
+    v16u8          v;
+
+    if (len < 16) {
+        memset_small(p, val, len);
+        return mem;
+    }
+
+    v = bcast128(( unsigned char )val);
+    if (len <= 32) {
+        st128(p, v);
+        st128(p + len - 16, v);
+        return mem;
+    }
+
+    if (len >= libk_ops.stosb_threshold) {
+        rep_stosb(p, val, len);
+        return mem;
+    }
+
+    /* Unaligned head, aligned 32-byte body, overlapping unaligned tail */
+    end = p + len;
+    st128(p, v);
+    q = ( unsigned char * )((( uintptr_t )p + 16) & ~( uintptr_t )15);
+    for (; q + 32 <= end; q += 32) {
+        *( v16u8 * )q        = v;
+        *( v16u8 * )(q + 16) = v;
+    }
+    if (end - q > 16)
+        *( v16u8 * )q = v;
+    st128(end - 16, v);
+
     return mem;
 }
 
+__avx2 void *memset_avx2(void *mem, int val, size_t len)
+{
+    unsigned char *p = ( unsigned char * )mem;
+    unsigned char *end, *q;
+    v32u8          v;
+
+    if (len < 16) {
+        memset_small(p, val, len);
+        return mem;
+    }
+
+    if (len <= 32) {
+        st128(p, bcast128(( unsigned char )val));
+        st128(p + len - 16, bcast128(( unsigned char )val));
+        return mem;
+    }
+
+    v = bcast256(( unsigned char )val);
+    if (len <= 64) {
+        st256(p, v);
+        st256(p + len - 32, v);
+        return mem;
+    }
+
+    if (len >= libk_ops.stosb_threshold) {
+        rep_stosb(p, val, len);
+        return mem;
+    }
+
+    /* Unaligned head, aligned 64-byte body, overlapping unaligned tail */
+    end = p + len;
+    st256(p, v);
+    q = ( unsigned char * )((( uintptr_t )p + 32) & ~( uintptr_t )31);
+    for (; q + 64 <= end; q += 64) {
+        *( v32u8 * )q        = v;
+        *( v32u8 * )(q + 32) = v;
+    }
+    if (end - q > 32)
+        *( v32u8 * )q = v;
+    st256(end - 32, v);
+
+    return mem;
+}
+
+void *memset(void *mem, int val, size_t len)
+{
+    return libk_ops.memset(mem, val, len);
+}
+
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,65 @@
+/* memset_nt.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "memimpl.h"
+
+/* Fill with non-temporal stores that bypass the cache, for large buffers
+ * that will not be read back soon (framebuffers, pages being zeroed). The
+ * unaligned head and tail go through memset, the 16-byte aligned body is
+ * written with movntdq and ordered with sfence before returning. */
+void *memset_nt(void *mem, int val, size_t size)
+{
+    unsigned char *p   = ( unsigned char * )mem;
+    unsigned char *end = p + size;
+    unsigned char *q   = ( unsigned char * )((( uintptr_t )p + 15) &
+                                           ~( uintptr_t )15);
+    v2di           v   = ( v2di )bcast128(( unsigned char )val);
+
+    if (size < 64)
+        return memset(mem, val, size);
+
+    memset(p, val, q - p);
+    for (; q + 64 <= end; q += 64) {
+        __builtin_ia32_movntdq(( v2di * )q, v);
+        __builtin_ia32_movntdq(( v2di * )(q + 16), v);
+        __builtin_ia32_movntdq(( v2di * )(q + 32), v);
+        __builtin_ia32_movntdq(( v2di * )(q + 48), v);
+    }
+    for (; q + 16 <= end; q += 16)
+        __builtin_ia32_movntdq(( v2di * )q, v);
+    memset(q, val, end - q);
+    __builtin_ia32_sfence();
+
+    return mem;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
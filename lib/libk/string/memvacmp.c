@@ -30,10 +30,40 @@
 
 #include <string.h>
 
+#include "memimpl.h"
+
+/* Returns non-zero when every byte of `memory` equals `val`. The region is
+ * XORed against `val` broadcast to a full vector and the results ORed
+ * together, so each 64 bytes costs a single test and one pass over memory. */
 int memvacmp(const void *memory, unsigned char val, size_t size)
 {
-    unsigned char *mm = ( unsigned char * )memory;
-    return (*mm == val) && memcmp(mm, mm + 1, size - 1) == 0;
+    const unsigned char *mm = ( const unsigned char * )memory;
+    const v16u8          z  = {0};
+    size_t               i  = 0;
+
+    if (size < 16) {
+        uint64_t w = bcast64(val);
+        if (size >= 8)
+            return ld64(mm) == w && ld64(mm + size - 8) == w;
+        for (; i < size; ++i)
+            if (mm[i] != val)
+                return 0;
+        return 1;
+    }
+
+    v16u8 v = bcast128(val);
+    for (; i + 64 <= size; i += 64) {
+        v16u8 acc = (ld128(mm + i) ^ v) | (ld128(mm + i + 16) ^ v) |
+                    (ld128(mm + i + 32) ^ v) | (ld128(mm + i + 48) ^ v);
+        if (eqmask128(acc, z) != 0xFFFF)
+            return 0;
+    }
+
+    /* Up to 63 bytes left, finished with an overlapping last vector */
+    v16u8 acc = ld128(mm + size - 16) ^ v;
+    for (; i + 16 < size; i += 16)
+        acc |= ld128(mm + i) ^ v;
+    return eqmask128(acc, z) == 0xFFFF;
 }
 
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -32,12 +32,7 @@
 
 char *strcpy(char *dest, const char *src)
 {
-    while (*src) {
-        *dest = *src;
-        dest++;
-        src++;
-    }
-    *dest = 0;
+    stpcpy(dest, src);
     return dest;
 }
 
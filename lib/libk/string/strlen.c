@@ -30,12 +30,39 @@
 
 #include <string.h>
 
-size_t strlen(const char *str)
+#include "memimpl.h"
+
+size_t strlen_sse2(const char *str)
 {
-    for (size_t len = 0;; ++len)
-        if (str[len] == 0)
-            return len;
-    return 0;
+    const unsigned char *p = scan_block(str);
+    scanmask_t           m = scan_eq(p, 0, ( const unsigned char * )str - p);
+
+    while (!m) {
+        p += SCAN_STRIDE;
+        m  = scan_eq(p, 0, 0);
+    }
+    return ( size_t )(p + scan_index(m) - ( const unsigned char * )str);
 }
 
+/* Same walk over 32-byte aligned blocks, which cannot cross a page either */
+__avx2 size_t strlen_avx2(const char *str)
+{
+    const unsigned char *s = ( const unsigned char * )str;
+    const unsigned char *p =
+            ( const unsigned char * )(( uintptr_t )s & ~( uintptr_t )31);
+    const v32u8 z = {0};
+    unsigned    m = eqmask256(*( const v32u8 * )p, z) >> (s - p);
+
+    if (m)
+        return ( size_t )__builtin_ctz(m);
+    for (;;) {
+        p += 32;
+        m  = eqmask256(*( const v32u8 * )p, z);
+        if (m)
+            return ( size_t )(p + __builtin_ctz(m) - s);
+    }
+}
+
+size_t strlen(const char *str) { return libk_ops.strlen(str); }
+
 // vim: ft=c ts=4 sts=4 sw=4 et ai cin
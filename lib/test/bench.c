@@ -0,0 +1,493 @@
+/* bench.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Host-side benchmark for libk, measured against the C library. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "host.h"
+
+#define MIN_SIZE   (( size_t )16)
+#define MAX_SIZE   (( size_t )2 << 20)
+#define BENCH_WORK (( size_t )256 << 20) /* Bytes touched per measurement */
+#define MOVE_SKEW  (( size_t )64)        /* dst - src for overlapping moves */
+#define CALL_MAX   (( size_t )1 << 20)   /* Most calls per ns/call sample */
+#define CALL_WORK  (( size_t )64 << 20)  /* Bytes touched per ns/call sample */
+
+/* Every table has one column per libk binding followed by the C library */
+#define LIBC nvariants
+
+static unsigned char *dst_buf;
+static unsigned char *src_buf;
+static volatile int   sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ( double )ts.tv_sec * 1e9 + ( double )ts.tv_nsec;
+}
+
+/* Run `call` (which may use the loop counter `i`) enough times to touch
+ * BENCH_WORK bytes after one warm up call, and return GB/s */
+#define TIMED(size, call)                                                      \
+    do {                                                                       \
+        size_t reps = BENCH_WORK / (size), i = 0;                              \
+        double t0;                                                             \
+        call;                                                                  \
+        t0 = now_ns();                                                         \
+        for (i = 0; i < reps; ++i)                                             \
+            call;                                                              \
+        return ( double )(reps * (size)) / (now_ns() - t0);                    \
+    } while (0)
+
+static double run_memset(size_t col, size_t size)
+{
+    void *(*volatile fn)(void *, int, size_t) = col == LIBC ? memset : k_memset;
+    TIMED(size, fn(dst_buf, ( int )i, size));
+}
+
+static double run_memcpy(size_t col, size_t size)
+{
+    void *(*volatile fn)(void *, const void *, size_t) =
+            col == LIBC ? memcpy : k_memcpy;
+    TIMED(size, fn(dst_buf, src_buf, size));
+}
+
+/* Overlapping moves, dst above src, forcing the backwards path */
+static double run_memmove(size_t col, size_t size)
+{
+    void *(*volatile fn)(void *, const void *, size_t) =
+            col == LIBC ? memmove : k_memmove;
+    TIMED(size, fn(dst_buf + MOVE_SKEW, dst_buf, size));
+}
+
+/* Equal buffers, so every byte is compared */
+static double run_memcmp(size_t col, size_t size)
+{
+    int (*volatile fn)(const void *, const void *, size_t) =
+            col == LIBC ? memcmp : k_memcmp;
+    TIMED(size, sink = fn(dst_buf, src_buf, size));
+}
+
+/* Strings start one byte past alignment to exercise the masked head */
+static double run_strlen(size_t col, size_t size)
+{
+    size_t (*volatile fn)(const char *) = col == LIBC ? strlen : k_strlen;
+    TIMED(size, sink = ( int )fn(( const char * )src_buf + 1));
+}
+
+#define FB_SIZE   (( size_t )4 << 20) /* A 1024x1024 32bpp framebuffer */
+#define WS_MAX    (( size_t )1 << 20)
+#define NT_ROUNDS 32
+
+/* Touch one word per cache line of `ws` and return the time taken */
+static double walk(const unsigned char *ws, size_t size)
+{
+    uint64_t sum = 0;
+    double   t0  = now_ns();
+    for (size_t off = 0; off < size; off += 64)
+        sum += *( const volatile uint64_t * )(ws + off);
+    sink = ( int )sum;
+    return now_ns() - t0;
+}
+
+/* Clear a 4 MiB framebuffer between walks of a cache-resident working set.
+ * Regular stores evict the working set, streaming stores leave it alone. */
+static void nt_table(void)
+{
+    static const struct {
+        const char *name;
+        void *(*fn)(void *, int, size_t);
+    } clears[] = {
+            {"memset",    k_memset   },
+            {"memset_nt", k_memset_nt},
+    };
+    static const size_t ws_sizes[] = {32 << 10, 256 << 10, WS_MAX};
+    unsigned char      *fb         = aligned_alloc(64, FB_SIZE);
+    unsigned char      *ws         = aligned_alloc(64, WS_MAX);
+
+    if (!fb || !ws) {
+        perror("aligned_alloc");
+        exit(EXIT_FAILURE);
+    }
+    memset(fb, 0, FB_SIZE);
+    memset(ws, 1, WS_MAX);
+
+    printf("\n4 MiB framebuffer clear vs working set walk (ns)\n%10s %10s",
+           "ws size", "hot");
+    for (size_t i = 0; i < ARRAY_LEN(clears); ++i)
+        printf(" %10s %10s", clears[i].name, "GB/s");
+    printf("\n");
+
+    for (size_t n = 0; n < ARRAY_LEN(ws_sizes); ++n) {
+        size_t size = ws_sizes[n];
+        double hot  = 0;
+        walk(ws, size);
+        for (int r = 0; r < NT_ROUNDS; ++r)
+            hot += walk(ws, size);
+        printf("%10zu %10.0f", size, hot / NT_ROUNDS);
+
+        for (size_t i = 0; i < ARRAY_LEN(clears); ++i) {
+            double clear = 0, after = 0, t0;
+            for (int r = 0; r < NT_ROUNDS; ++r) {
+                walk(ws, size);
+                t0     = now_ns();
+                clears[i].fn(fb, r, FB_SIZE);
+                clear += now_ns() - t0;
+                after += walk(ws, size);
+            }
+            printf(" %10.0f %10.2f", after / NT_ROUNDS,
+                   ( double )(FB_SIZE * NT_ROUNDS) / clear);
+        }
+        printf("\n");
+    }
+
+    free(fb);
+    free(ws);
+}
+
+/* 2D operations over a 640x480 image in each format, every call covering
+ * the whole of it. The source is a hash pattern with runs of the colour key
+ * and alpha all over the place, so the keyed and blended paths are mixed
+ * rather than all skipped or all copied. */
+#define GFX_W     640
+#define GFX_H     480
+#define GFX_WORK  (( size_t )64 << 20) /* Pixels per measurement */
+#define GFX_KEY   0x00FF00FFu
+
+static struct gfx_surface gfx_dst, gfx_src;
+
+static int op_fill(void)
+{
+    return k_gfx_fill(&gfx_dst, 0, 0, GFX_W, GFX_H, 0x00336699);
+}
+
+static int op_blit(void)
+{
+    return k_gfx_blit(&gfx_dst, 0, 0, &gfx_src, 0, 0, GFX_W, GFX_H);
+}
+
+static int op_key(void)
+{
+    return k_gfx_blit_key(&gfx_dst, 0, 0, &gfx_src, 0, 0, GFX_W, GFX_H,
+                          GFX_KEY);
+}
+
+static int op_blend(void)
+{
+    return k_gfx_blend(&gfx_dst, 0, 0, &gfx_src, 0, 0, GFX_W, GFX_H);
+}
+
+static int op_convert(void)
+{
+    return k_gfx_convert(&gfx_dst, 0, 0, &gfx_src, 0, 0, GFX_W, GFX_H);
+}
+
+static const struct {
+    const char     *name;
+    int             (*op)(void);
+    enum gfx_format to, from;
+} gfx_ops[] = {
+        {"fill",      op_fill,    GFX_XRGB8888, GFX_XRGB8888},
+        {"blit",      op_blit,    GFX_XRGB8888, GFX_XRGB8888},
+        {"blit_key",  op_key,     GFX_XRGB8888, GFX_XRGB8888},
+        {"blend",     op_blend,   GFX_XRGB8888, GFX_XRGB8888},
+        {"xrgb>888",  op_convert, GFX_RGB888,   GFX_XRGB8888},
+        {"888>xrgb",  op_convert, GFX_XRGB8888, GFX_RGB888  },
+        {"xrgb>565",  op_convert, GFX_RGB565,   GFX_XRGB8888},
+        {"565>xrgb",  op_convert, GFX_XRGB8888, GFX_RGB565  },
+        {"xrgb>idx8", op_convert, GFX_INDEXED8, GFX_XRGB8888},
+        {"idx8>xrgb", op_convert, GFX_XRGB8888, GFX_INDEXED8},
+        {"565>888",   op_convert, GFX_RGB888,   GFX_RGB565  },
+};
+
+static struct gfx_surface gfx_surface(void *buf, enum gfx_format format)
+{
+    static uint32_t palette[256];
+
+    k_gfx_palette332(palette);
+    return ( struct gfx_surface ){.pixels  = buf,
+                                  .pitch   = GFX_W * k_gfx_bytes(format),
+                                  .width   = GFX_W,
+                                  .height  = GFX_H,
+                                  .format  = format,
+                                  .palette = palette};
+}
+
+/* Only the SIMD level matters to these kernels, so the ERMS bindings are
+ * left out */
+static void gfx_table(void)
+{
+    uint32_t *src = ( uint32_t * )src_buf;
+
+    for (uint32_t i = 0; i < GFX_W * GFX_H; ++i)
+        src[i] = (i / 16) % 4 ? i * 2654435761u : GFX_KEY;
+
+    printf("\n2D operations on %ux%u (MP/s)\n%10s", GFX_W, GFX_H, "op");
+    for (size_t col = 0; col < LIBC; ++col)
+        if (!(variants[col].features & CPU_FEATURE_ERMS))
+            printf(" %10s", variants[col].name);
+    printf("\n");
+
+    for (size_t r = 0; r < ARRAY_LEN(gfx_ops); ++r) {
+        gfx_dst = gfx_surface(dst_buf, gfx_ops[r].to);
+        gfx_src = gfx_surface(src_buf, gfx_ops[r].from);
+        printf("%10s", gfx_ops[r].name);
+        for (size_t col = 0; col < LIBC; ++col) {
+            size_t reps = GFX_WORK / (GFX_W * GFX_H);
+            double t0;
+
+            if (variants[col].features & CPU_FEATURE_ERMS)
+                continue;
+            if (!variant_supported(&variants[col])) {
+                printf(" %10s", "-");
+                continue;
+            }
+            k_libk_dispatch(variants[col].features);
+            gfx_ops[r].op();
+            t0 = now_ns();
+            for (size_t i = 0; i < reps; ++i)
+                gfx_ops[r].op();
+            printf(" %10.1f",
+                   ( double )(reps * GFX_W * GFX_H) * 1e3 / (now_ns() - t0));
+        }
+        printf("\n");
+    }
+}
+
+/* Per-call wrappers, so every routine can be timed by the same loop. Stores
+ * go to dst_buf as 'a' bytes and string rows terminate src_buf at `size`, so
+ * dst_buf and src_buf compare equal up to the terminator. */
+static void call_memset(size_t size) { k_memset(dst_buf, 'a', size); }
+static void call_memset_nt(size_t size) { k_memset_nt(dst_buf, 'a', size); }
+static void call_memcpy(size_t size) { k_memcpy(dst_buf, src_buf, size); }
+static void call_memcpy_nt(size_t size) { k_memcpy_nt(dst_buf, src_buf, size); }
+static void call_memmove(size_t size)
+{
+    k_memmove(dst_buf + MOVE_SKEW, dst_buf, size);
+}
+static void call_memcmp(size_t size)
+{
+    sink = k_memcmp(dst_buf, src_buf, size);
+}
+static void call_memvacmp(size_t size)
+{
+    sink = k_memvacmp(src_buf, 'a', size);
+}
+static void call_memchr(size_t size)
+{
+    sink = k_memchr(src_buf, 'b', size) != NULL;
+}
+static void call_strlen(size_t size)
+{
+    sink = ( int )k_strlen(( const char * )src_buf) + ( int )size;
+}
+static void call_strnlen(size_t size)
+{
+    sink = ( int )k_strnlen(( const char * )src_buf, size);
+}
+static void call_strchr(size_t size)
+{
+    sink = k_strchr(( const char * )src_buf, 'b') != NULL && size;
+}
+static void call_stpcpy(size_t size)
+{
+    sink = k_stpcpy(( char * )dst_buf, ( const char * )src_buf) !=
+           ( char * )dst_buf + size;
+}
+
+static void call_itoa(size_t size)
+{
+    char buf[16];
+    k_itoa(( int )size * 7919, buf, 10);
+    sink = buf[0];
+}
+
+static void call_ltoa(size_t size)
+{
+    char buf[24];
+    k_ltoa(( long )size * 0x7FFFFFFFFFFFL, buf, 10);
+    sink = buf[0];
+}
+
+static void call_printf(size_t size)
+{
+    console_reset();
+    sink = k_printf("[%s] %d of %l\n", "libk", ( int )size, ( long )size);
+}
+
+static void call_kprint(size_t size)
+{
+    kprint("[", "libk", "] ", ( int )size, " of ", ( long )size, "\n");
+}
+
+static void call_trace(size_t size)
+{
+    trace_printf("[%s] %d of %ld\n", "libk", ( int )size, ( long )size);
+}
+
+static const struct {
+    const char *name;
+    void (*call)(size_t);
+    int strings; /* Needs src_buf terminated at size */
+} calls[] = {
+        {"memset",    call_memset,    0},
+        {"memset_nt", call_memset_nt, 0},
+        {"memcpy",    call_memcpy,    0},
+        {"memcpy_nt", call_memcpy_nt, 0},
+        {"memmove",   call_memmove,   0},
+        {"memcmp",    call_memcmp,    0},
+        {"memvacmp",  call_memvacmp,  0},
+        {"memchr",    call_memchr,    0},
+        {"strlen",    call_strlen,    1},
+        {"strnlen",   call_strnlen,   1},
+        {"strchr",    call_strchr,    1},
+        {"stpcpy",    call_stpcpy,    1},
+        {"itoa",      call_itoa,      0},
+        {"ltoa",      call_ltoa,      0},
+        {"printf",    call_printf,    0},
+        {"kprint",    call_kprint,    0},
+        {"trace",     call_trace,     0},
+};
+
+/* ns/call and TSC cycles/byte for every routine under the fastest binding
+ * the host supports. The conversions ignore the size, only ns/call matters
+ * for them. */
+static void call_table(void)
+{
+    static const size_t sizes[] = {16, 256, 4096, 65536};
+    const struct variant *best  = &variants[0];
+
+    for (size_t v = 0; v < nvariants; ++v)
+        if (variant_supported(&variants[v]))
+            best = &variants[v];
+    k_libk_dispatch(best->features);
+    /* gfx_table() leaves its pixels in src_buf */
+    memset(src_buf, 'a', MAX_SIZE + MOVE_SKEW);
+    memset(dst_buf, 'a', MAX_SIZE + MOVE_SKEW);
+
+    printf("\nPer call cost, %s (ns/call, TSC cycles/byte)\n%10s", best->name,
+           "routine");
+    for (size_t n = 0; n < ARRAY_LEN(sizes); ++n)
+        printf(" %8zu %6s", sizes[n], "c/B");
+    printf("\n");
+
+    for (size_t r = 0; r < ARRAY_LEN(calls); ++r) {
+        printf("%10s", calls[r].name);
+        for (size_t n = 0; n < ARRAY_LEN(sizes); ++n) {
+            size_t   size = sizes[n];
+            size_t   reps = CALL_WORK / size;
+            uint64_t c0;
+            double   t0;
+
+            if (reps > CALL_MAX)
+                reps = CALL_MAX;
+            if (calls[r].strings)
+                src_buf[size] = '\0';
+            calls[r].call(size);
+            t0 = now_ns();
+            c0 = __builtin_ia32_rdtsc();
+            for (size_t i = 0; i < reps; ++i)
+                calls[r].call(size);
+            c0 = __builtin_ia32_rdtsc() - c0;
+            t0 = now_ns() - t0;
+            printf(" %8.1f %6.3f", t0 / ( double )reps,
+                   ( double )c0 / ( double )(reps * size));
+            if (calls[r].strings) {
+                src_buf[size] = 'a';
+                dst_buf[size] = 'a';
+            }
+        }
+        printf("\n");
+    }
+}
+
+static void table(const char *title, double (*run)(size_t, size_t),
+                  size_t max_size, int strings)
+{
+    printf("\n%s (GB/s)\n%10s", title, "size");
+    for (size_t col = 0; col < LIBC; ++col)
+        printf(" %10s", variants[col].name);
+    printf(" %10s\n", "libc");
+
+    for (size_t size = MIN_SIZE; size <= max_size; size <<= 1) {
+        if (strings)
+            src_buf[size + 1] = '\0';
+        printf("%10zu", size);
+        for (size_t col = 0; col <= LIBC; ++col) {
+            if (col < LIBC && !variant_supported(&variants[col])) {
+                printf(" %10s", "-");
+                continue;
+            }
+            if (col < LIBC)
+                k_libk_dispatch(variants[col].features);
+            printf(" %10.2f", run(col, size));
+        }
+        printf("\n");
+        if (strings)
+            src_buf[size + 1] = 'a';
+    }
+}
+
+int main(void)
+{
+    dst_buf = aligned_alloc(64, MAX_SIZE + MOVE_SKEW);
+    src_buf = aligned_alloc(64, MAX_SIZE + MOVE_SKEW);
+    if (!dst_buf || !src_buf) {
+        perror("aligned_alloc");
+        return EXIT_FAILURE;
+    }
+    memset(src_buf, 'a', MAX_SIZE + MOVE_SKEW);
+    memset(dst_buf, 'a', MAX_SIZE + MOVE_SKEW);
+
+    table("memset", run_memset, MAX_SIZE, 0);
+    table("memcpy", run_memcpy, MAX_SIZE, 0);
+    table("memmove backwards", run_memmove, MAX_SIZE, 0);
+    memcpy(dst_buf, src_buf, MAX_SIZE);
+    table("memcmp", run_memcmp, MAX_SIZE, 0);
+    table("strlen", run_strlen, MAX_SIZE / 2, 1);
+
+    k_libk_dispatch(BASE | ERMS);
+    nt_table();
+
+    gfx_table();
+    call_table();
+
+    free(dst_buf);
+    free(src_buf);
+    return EXIT_SUCCESS;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
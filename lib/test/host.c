@@ -0,0 +1,81 @@
+/* host.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Host replacements for the kernel pieces libk links against, and the table
+ * of dispatch bindings shared by the test and benchmark programs. */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "host.h"
+
+#define CONSOLE_SIZE 4096
+
+const struct variant variants[] = {
+        {"sse2",      BASE       },
+        {"sse2+erms", BASE | ERMS},
+        {"avx2",      AVX2       },
+        {"avx2+erms", AVX2 | ERMS},
+};
+
+const size_t nvariants = ARRAY_LEN(variants);
+
+/* rep movsb/stosb work everywhere, ERMS only makes them fast */
+int variant_supported(const struct variant *v)
+{
+    return !(v->features & CPU_FEATURE_AVX2) ||
+           __builtin_cpu_supports("avx2");
+}
+
+char   console_buf[CONSOLE_SIZE];
+size_t console_len;
+size_t console_writes;
+
+void console_reset(void)
+{
+    console_len    = 0;
+    console_writes = 0;
+    console_buf[0] = '\0';
+}
+
+/* Output past the end of the buffer is dropped, tests keep lines short */
+void console_capture(const char *data, size_t size)
+{
+    console_writes++;
+    if (size > CONSOLE_SIZE - 1 - console_len)
+        size = CONSOLE_SIZE - 1 - console_len;
+    memcpy(console_buf + console_len, data, size);
+    console_len              += size;
+    console_buf[console_len]  = '\0';
+}
+
+struct console host_console = {.name = "host", .write = console_capture};
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
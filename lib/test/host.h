@@ -0,0 +1,152 @@
+/* host.h
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Shared declarations for the host-side libk test and benchmark programs. The
+ * libk objects are built for the host with every symbol prefixed (k_memset,
+ * ...) so they link side by side with the C library they are checked and
+ * measured against. */
+
+#ifndef _TEST_HOST_H
+#define _TEST_HOST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../../include/kernel/x86/cpu.h"
+
+#define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+void k_libk_dispatch(uint32_t features);
+
+void  *k_memchr(const void *, int, size_t);
+int    k_memcmp(const void *, const void *, size_t);
+int    k_memvacmp(const void *, unsigned char, size_t);
+void  *k_memcpy(void *, const void *, size_t);
+void  *k_memmove(void *, const void *, size_t);
+void  *k_memset(void *, int, size_t);
+void  *k_memcpy_nt(void *, const void *, size_t);
+void  *k_memset_nt(void *, int, size_t);
+size_t k_strlen(const char *);
+size_t k_strnlen(const char *, size_t);
+char  *k_strchr(const char *, int);
+char  *k_strcpy(char *, const char *);
+char  *k_stpcpy(char *, const char *);
+
+int   k_abs(int);
+long  k_labs(long);
+char *k_itoa(int, char *, int);
+char *k_ltoa(long, char *, int);
+char *k_utoa(unsigned int, char *, int);
+char *k_ultoa(unsigned long, char *, int);
+
+int k_printf(const char *restrict, ...);
+int k_snprintf(char *restrict, size_t, const char *restrict, ...);
+int k_putchar(int);
+int k_puts(const char *);
+
+/* libk's own headers for the gfx, log, console, trace and kprint APIs, with
+ * every name their macros expand to pointed at the prefixed host build */
+#ifndef __printflike
+#define __printflike(fmtarg, firstvararg)                                      \
+    __attribute__((__format__(__printf__, fmtarg, firstvararg)))
+#endif
+
+#define klog_write            k_klog_write
+#define klog_drain            k_klog_drain
+#define klog_dump             k_klog_dump
+#define klog_reader_init      k_klog_reader_init
+#define klog_drain_from       k_klog_drain_from
+#define klog_dump_from        k_klog_dump_from
+
+#define console_register      k_console_register
+#define console_select        k_console_select
+#define console_parse_cmdline k_console_parse_cmdline
+#define console_write         k_console_write
+#define console_drain         k_console_drain
+#define console_dump          k_console_dump
+
+#define trace_write           k_trace_write
+#define trace_dump            k_trace_dump
+
+#define kprint_span           k_kprint_span
+#define kprint_long           k_kprint_long
+#define kprint_ulong          k_kprint_ulong
+#define kprint_hex            k_kprint_hex
+#define kprint_char           k_kprint_char
+#define kprint_ptr            k_kprint_ptr
+#define kprint_flush          k_kprint_flush
+
+#define gfx_bytes             k_gfx_bytes
+#define gfx_palette332        k_gfx_palette332
+#define gfx_fill              k_gfx_fill
+#define gfx_blit              k_gfx_blit
+#define gfx_blit_key          k_gfx_blit_key
+#define gfx_blend             k_gfx_blend
+#define gfx_convert           k_gfx_convert
+#define gfx_fill32            k_gfx_fill32
+#define gfx_copy32            k_gfx_copy32
+#define gfx_key32             k_gfx_key32
+#define gfx_blend32           k_gfx_blend32
+
+#include "../include/sys/gfx.h"
+#include "../include/sys/klog.h"
+#include "../include/sys/console.h" /* Its <sys/klog.h> is glibc's here */
+#include "../include/sys/kprint.h"
+#include "../include/sys/trace.h"
+
+#define BASE (CPU_FEATURE_SSE2)
+#define AVX2 (CPU_FEATURE_SSE2 | CPU_FEATURE_AVX | CPU_FEATURE_AVX2)
+#define ERMS (CPU_FEATURE_ERMS | CPU_FEATURE_FSRM)
+
+/* Every libk binding worth measuring or checking, see host.c */
+struct variant {
+    const char *name;
+    uint32_t    features;
+};
+
+extern const struct variant variants[];
+extern const size_t         nvariants;
+
+int variant_supported(const struct variant *v);
+
+/* The host console appends everything written to it to a buffer and counts
+ * the calls that delivered it */
+extern char           console_buf[];
+extern size_t         console_len;
+extern size_t         console_writes;
+extern struct console host_console;
+
+void console_capture(const char *data, size_t size);
+
+void console_reset(void);
+
+#endif /* _TEST_HOST_H */
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,1024 @@
+/* test.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Differential tests for libk. Each routine is run against the C library on
+ * random sizes, alignments and overlaps under every dispatch binding the host
+ * supports. The whole arena is compared after every call so writes outside
+ * the destination are caught, and string scans are also run against a guard
+ * page to catch reads past the terminator that cross into unmapped memory. */
+
+#define _GNU_SOURCE /* pthread_tryjoin_np */
+
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "host.h"
+
+#define ARENA     (( size_t )3 << 13) /* Room for two 8 KiB operands + slack */
+#define MAX_ALIGN 64
+#define ROUNDS    20000
+
+static unsigned char arena[ARENA];
+static unsigned char expect[ARENA];
+static unsigned char *guard_end; /* First byte of a PROT_NONE page */
+static uint64_t       rng_state = 0x9E3779B97F4A7C15ull;
+static unsigned       failures;
+static const char    *binding = "-";
+
+static uint64_t rnd(void)
+{
+    uint64_t x = rng_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return rng_state = x;
+}
+
+/* Mostly short sizes where the head/tail logic lives, with the occasional
+ * size large enough to reach the vector loops and rep thresholds */
+static size_t rnd_size(void)
+{
+    switch (rnd() % 8) {
+    case 0:
+        return rnd() % 8192;
+    case 1:
+    case 2:
+        return rnd() % 512;
+    default:
+        return rnd() % 80;
+    }
+}
+
+static void rnd_fill(unsigned char *p, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+        p[i] = ( unsigned char )rnd();
+}
+
+static int sign(int x) { return (x > 0) - (x < 0); }
+
+#define FAIL(name, ...)                                                        \
+    do {                                                                       \
+        if (failures++ < 20) {                                                 \
+            printf("FAIL %s [%s]: ", name, binding);                           \
+            printf(__VA_ARGS__);                                               \
+            printf("\n");                                                      \
+        }                                                                      \
+    } while (0)
+
+static void check_arena(const char *name, size_t a, size_t b, size_t size)
+{
+    if (memcmp(arena, expect, ARENA) != 0)
+        FAIL(name, "a=%zu b=%zu size=%zu", a, b, size);
+}
+
+static void test_memset(void)
+{
+    for (int r = 0; r < ROUNDS; ++r) {
+        size_t size = rnd_size(), off = rnd() % MAX_ALIGN;
+        int    c    = ( int )rnd();
+        rnd_fill(arena, ARENA);
+        memcpy(expect, arena, ARENA);
+
+        memset(expect + off, c, size);
+        if (k_memset(arena + off, c, size) != arena + off)
+            FAIL("memset", "return value");
+        check_arena("memset", off, 0, size);
+
+        memset(expect + off, c + 1, size);
+        if (k_memset_nt(arena + off, c + 1, size) != arena + off)
+            FAIL("memset_nt", "return value");
+        check_arena("memset_nt", off, 0, size);
+    }
+}
+
+static void test_memcpy(void)
+{
+    for (int r = 0; r < ROUNDS; ++r) {
+        size_t size = rnd_size(), d = rnd() % MAX_ALIGN;
+        size_t s    = ARENA / 2 + rnd() % MAX_ALIGN;
+        rnd_fill(arena, ARENA);
+        memcpy(expect, arena, ARENA);
+
+        memcpy(expect + d, expect + s, size);
+        if (k_memcpy(arena + d, arena + s, size) != arena + d)
+            FAIL("memcpy", "return value");
+        check_arena("memcpy", d, s, size);
+
+        rnd_fill(arena + s, size);
+        memcpy(expect + s, arena + s, size);
+        memcpy(expect + d, expect + s, size);
+        if (k_memcpy_nt(arena + d, arena + s, size) != arena + d)
+            FAIL("memcpy_nt", "return value");
+        check_arena("memcpy_nt", d, s, size);
+    }
+}
+
+/* Source and destination anywhere in the arena, so every overlap in both
+ * directions turns up, including d == s */
+static void test_memmove(void)
+{
+    for (int r = 0; r < ROUNDS; ++r) {
+        size_t size = rnd_size() % (ARENA / 2);
+        size_t d    = rnd() % (ARENA - size + 1);
+        size_t s    = rnd() % 4 ? d + rnd() % 256 - 128 : rnd() % ARENA;
+        if (s > ARENA - size)
+            s = ARENA - size;
+        rnd_fill(arena, ARENA);
+        memcpy(expect, arena, ARENA);
+
+        memmove(expect + d, expect + s, size);
+        if (k_memmove(arena + d, arena + s, size) != arena + d)
+            FAIL("memmove", "return value");
+        check_arena("memmove", d, s, size);
+    }
+}
+
+static void test_memcmp(void)
+{
+    for (int r = 0; r < ROUNDS; ++r) {
+        size_t         size = rnd_size();
+        unsigned char *a    = arena + rnd() % MAX_ALIGN;
+        unsigned char *b    = arena + ARENA / 2 + rnd() % MAX_ALIGN;
+        rnd_fill(a, size);
+        memcpy(b, a, size);
+        /* Usually differ in one byte, sometimes past the end */
+        if (size && rnd() % 4) {
+            size_t at = rnd() % (size + size / 8 + 1);
+            if (at < size)
+                b[at] = ( unsigned char )rnd();
+        }
+        if (sign(k_memcmp(a, b, size)) != sign(memcmp(a, b, size)))
+            FAIL("memcmp", "size=%zu", size);
+        if (sign(k_memcmp(b, a, size)) != sign(memcmp(b, a, size)))
+            FAIL("memcmp", "swapped size=%zu", size);
+    }
+}
+
+static void test_memvacmp(void)
+{
+    for (int r = 0; r < ROUNDS; ++r) {
+        size_t        size = rnd_size(), off = rnd() % MAX_ALIGN;
+        unsigned char c    = ( unsigned char )rnd();
+        unsigned char *p   = arena + off;
+        int           want = 1;
+        memset(p, c, size);
+        if (size && rnd() % 2) {
+            size_t at = rnd() % size;
+            p[at]     = ( unsigned char )rnd();
+            want      = p[at] == c;
+        }
+        if (!k_memvacmp(p, c, size) != !want)
+            FAIL("memvacmp", "size=%zu off=%zu", size, off);
+    }
+}
+
+/* A random string of non-zero bytes with more random bytes, zeros included,
+ * after its terminator */
+static char *rnd_string(unsigned char *buf, size_t len, size_t tail)
+{
+    rnd_fill(buf, len + 1 + tail);
+    for (size_t i = 0; i < len; ++i)
+        if (!buf[i])
+            buf[i] = 1;
+    buf[len] = '\0';
+    return ( char * )buf;
+}
+
+/* `avail` is how many bytes from `s` may be read, which bounds memchr */
+static void check_strings(const char *s, size_t len, size_t avail)
+{
+    size_t max = rnd() % (avail + 1);
+    char  *dst = ( char * )arena + ARENA / 2 + rnd() % MAX_ALIGN;
+    char   c   = rnd() % 4 ? s[rnd() % (len + 1)] : ( char )rnd();
+
+    if (k_strlen(s) != len)
+        FAIL("strlen", "len=%zu got=%zu", len, k_strlen(s));
+    if (k_strnlen(s, max) != strnlen(s, max))
+        FAIL("strnlen", "len=%zu max=%zu", len, max);
+    if (k_strchr(s, c) != strchr(s, c))
+        FAIL("strchr", "len=%zu c=%d", len, c);
+    if (k_memchr(s, c, max) != memchr(s, c, max))
+        FAIL("memchr", "size=%zu c=%d", max, c);
+
+    memset(dst, 'x', len + 2);
+    if (k_stpcpy(dst, s) != dst + len || memcmp(dst, s, len + 1) ||
+        dst[len + 1] != 'x')
+        FAIL("stpcpy", "len=%zu", len);
+    memset(dst, 'x', len + 2);
+    if (k_strcpy(dst, s) != dst || memcmp(dst, s, len + 1) ||
+        dst[len + 1] != 'x')
+        FAIL("strcpy", "len=%zu", len);
+}
+
+static void test_strings(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+
+    for (int r = 0; r < ROUNDS; ++r) {
+        size_t len = rnd_size() % (ARENA / 4);
+        check_strings(rnd_string(arena + rnd() % MAX_ALIGN, len, 64), len,
+                      len + 65);
+
+        /* Terminator as close to the guard page as it can get */
+        len = rnd() % ( size_t )page;
+        check_strings(rnd_string(guard_end - len - 1, len, 0), len, len + 1);
+    }
+}
+
+/* Reference conversion for the bases libc's printf cannot produce */
+static void utoa_ref(unsigned long n, char *buf, unsigned base)
+{
+    char   tmp[72];
+    size_t i = 0;
+    do {
+        tmp[i++] = "0123456789abcdefghijklmnopqrstuvwxyz"[n % base];
+        n       /= base;
+    } while (n);
+    while (i)
+        *buf++ = tmp[--i];
+    *buf = '\0';
+}
+
+static long rnd_long(void)
+{
+    /* Spread the magnitudes so every digit count is covered */
+    long n = ( long )(rnd() >> (rnd() % 64));
+    return rnd() % 2 ? n : -n;
+}
+
+#define CHECK_CONV(name, call, want, fmt, n)                                   \
+    do {                                                                       \
+        if ((call) != got || strcmp(got, want))                                \
+            FAIL(name, fmt " base %d: got %s want %s", n, base, got, want);    \
+    } while (0)
+
+static void test_itoa(void)
+{
+    static const long edges[] = {0, 1, -1, INT_MAX, INT_MIN, LONG_MAX,
+                                 LONG_MIN};
+    char              got[72], want[72];
+
+    for (int r = 0; r < ROUNDS; ++r) {
+        long n    = r < ( int )ARRAY_LEN(edges) ? edges[r] : rnd_long();
+        int  i    = ( int )n;
+        int  base = rnd() % 2 ? 10 : ( int )(2 + rnd() % 35);
+
+        /* Decimal is signed, other bases print the two's complement */
+        if (base == 10)
+            snprintf(want, sizeof(want), "%d", i);
+        else
+            utoa_ref(( unsigned )i, want, base);
+        CHECK_CONV("itoa", k_itoa(i, got, base), want, "%d", i);
+
+        if (base == 10)
+            snprintf(want, sizeof(want), "%ld", n);
+        else
+            utoa_ref(( unsigned long )n, want, base);
+        CHECK_CONV("ltoa", k_ltoa(n, got, base), want, "%ld", n);
+
+        utoa_ref(( unsigned )i, want, base);
+        CHECK_CONV("utoa", k_utoa(( unsigned )i, got, base), want, "%u",
+                   ( unsigned )i);
+
+        utoa_ref(( unsigned long )n, want, base);
+        CHECK_CONV("ultoa", k_ultoa(( unsigned long )n, got, base), want,
+                   "%lu", ( unsigned long )n);
+
+        if (i != INT_MIN && n != LONG_MIN &&
+            (k_abs(i) != abs(i) || k_labs(n) != labs(n)))
+            FAIL("abs", "%ld", n);
+    }
+
+    for (int base = -1; base < 40; base += 38) {
+        got[0] = 'x';
+        if (k_ultoa(1234, got, base) != got || got[0])
+            FAIL("ultoa", "base %d should give an empty string", base);
+    }
+}
+
+/* Build a random conversion with flags, width and precision, format it with
+ * both libk and the C library and compare */
+static void check_conversion(void)
+{
+    static const char flags[] = "-0+ #";
+    static const char convs[] = "diuxXobcsp%";
+    char              spec[32], want[512], got[512];
+    char              c     = convs[rnd() % (sizeof(convs) - 1)];
+    int               longs = !strchr("csp%", c) && rnd() % 2;
+    char             *p     = spec;
+    long              v     = rnd_long();
+    size_t            size  = rnd() % 4 ? sizeof(got) : rnd() % 16;
+    int               n, k;
+
+    *p++ = '%';
+    for (int i = rnd() % 3; i > 0; --i)
+        *p++ = flags[rnd() % (sizeof(flags) - 1)];
+    if (rnd() % 2)
+        p += sprintf(p, "%u", ( unsigned )(rnd() % 24));
+    if (rnd() % 3 == 0 && c != 'c' && c != 'p')
+        p += sprintf(p, ".%u", ( unsigned )(rnd() % 12));
+    if (longs)
+        *p++ = 'l';
+    *p++ = c;
+    *p   = '\0';
+
+    /* Combinations the C library leaves undefined or spells differently */
+    if (c == '%' && spec[1] != '%')
+        return;
+    if (strchr("csp", c) && strpbrk(spec, "0+ #"))
+        return;
+    if (strchr("dui", c) && strchr(spec, '#'))
+        return;
+    if (c == 'p' && !v)
+        return; /* glibc prints (nil) */
+
+#define BOTH(...)                                                              \
+    do {                                                                       \
+        n = snprintf(want, sizeof(want), spec, __VA_ARGS__);                   \
+        k = k_snprintf(got, size, spec, __VA_ARGS__);                          \
+    } while (0)
+
+    switch (c) {
+    case 'd':
+    case 'i':
+        if (longs)
+            BOTH(v);
+        else
+            BOTH(( int )v);
+        break;
+    case 'b':
+        /* No %b in the C library, so print %x and spell it out in binary */
+        spec[p - spec - 1] = 'x';
+        if (strchr(spec, '#') || strchr(spec, '.'))
+            return;
+        snprintf(want, sizeof(want), spec, 0);
+        k = k_snprintf(got, sizeof(got), longs ? "%lb" : "%b", v);
+        utoa_ref(longs ? ( unsigned long )v : ( unsigned )v, want, 2);
+        n    = ( int )strlen(want);
+        size = sizeof(got);
+        break;
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+        if (longs)
+            BOTH(( unsigned long )v);
+        else
+            BOTH(( unsigned )v);
+        break;
+    case 'c':
+        BOTH('A' + ( int )(( unsigned long )v % 26));
+        break;
+    case 's':
+        BOTH(v % 8 ? "console" : "");
+        break;
+    case 'p':
+        BOTH(( void * )v);
+        break;
+    default:
+        BOTH(0);
+        break;
+    }
+#undef BOTH
+
+    if (k != n || (size && strncmp(got, want, size - 1)) ||
+        (size && strlen(got) != (( size_t )n < size ? ( size_t )n : size - 1)))
+        FAIL("snprintf", "\"%s\" size %zu: got %d \"%s\" want %d \"%s\"", spec,
+             size, k, size ? got : "", n, want);
+}
+
+static void test_printf(void)
+{
+    char want[256], big[1500];
+    int  n;
+
+    for (int r = 0; r < ROUNDS; ++r)
+        check_conversion();
+
+    for (int r = 0; r < ROUNDS / 10; ++r) {
+        long        l = rnd_long();
+        int         d = ( int )rnd_long();
+        unsigned    u = ( unsigned )rnd();
+        char        c = ( char )(rnd() % 94 + 33);
+        const char *s = "libk";
+
+        /* A bare %l predates the length modifiers and still means %ld */
+        snprintf(want, sizeof(want), "x%d %s%c %u 100%% %ld\n", d, s, c, u,
+                 l);
+        console_reset();
+        n = k_printf("x%d %s%c %u 100%% %l\n", d, s, c, u, l);
+        k_klog_drain(console_capture);
+        if (strcmp(console_buf, want) || n != ( int )strlen(want))
+            FAIL("printf", "got \"%s\" want \"%s\"", console_buf, want);
+        if (console_writes != 1)
+            FAIL("printf", "%zu writes for one line", console_writes);
+    }
+
+    /* Output longer than the printf buffer spans several log records */
+    memset(big, 'z', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    console_reset();
+    n = k_printf("<%s>", big);
+    k_klog_drain(console_capture);
+    if (n != ( int )sizeof(big) + 1 ||
+        strlen(console_buf) != sizeof(big) + 1 || console_buf[0] != '<' ||
+        strspn(console_buf + 1, "z") != sizeof(big) - 1)
+        FAIL("printf", "long output");
+
+    console_reset();
+    k_puts("puts");
+    if (strcmp(console_buf, "puts") || console_writes != 1)
+        FAIL("puts", "got \"%s\"", console_buf);
+}
+
+#define KLOG_THREADS 4
+#define KLOG_MSGS    50000
+
+static char  *klog_out;
+static size_t klog_out_len;
+
+static void klog_collect(const char *data, size_t size)
+{
+    memcpy(klog_out + klog_out_len, data, size);
+    klog_out_len += size;
+}
+
+static void *klog_producer(void *arg)
+{
+    int  t = ( int )( intptr_t )arg;
+    char line[32];
+    for (int i = 0; i < KLOG_MSGS; ++i) {
+        int n = snprintf(line, sizeof(line), "t%d %06d\n", t, i);
+        k_klog_write(line, ( size_t )n);
+        if (i % 16 == 0)
+            sched_yield(); /* Give the drain a chance to keep up */
+    }
+    return NULL;
+}
+
+/* Every line drained is either a whole message or a lost records note, each
+ * producer's messages come out in order, and received + lost adds up */
+static void check_klog_lines(void)
+{
+    int   next[KLOG_THREADS] = {0};
+    long  lost = 0, got = 0;
+    char *line = klog_out, *end = klog_out + klog_out_len;
+
+    while (line < end) {
+        char *nl = memchr(line, '\n', ( size_t )(end - line));
+        int   t, i;
+        long  n;
+        if (!nl) {
+            FAIL("klog", "unterminated line");
+            return;
+        }
+        *nl = '\0';
+        if (sscanf(line, "[klog] %ld records lost", &n) == 1) {
+            lost += n;
+        } else if (sscanf(line, "t%d %d", &t, &i) == 2 && t >= 0 &&
+                   t < KLOG_THREADS && i >= next[t] && strlen(line) == 9) {
+            next[t] = i + 1;
+            got++;
+        } else {
+            FAIL("klog", "bad line \"%s\"", line);
+            return;
+        }
+        line = nl + 1;
+    }
+    if (got + lost != ( long )KLOG_THREADS * KLOG_MSGS)
+        FAIL("klog", "%ld received + %ld lost", got, lost);
+}
+
+static void test_klog(void)
+{
+    pthread_t threads[KLOG_THREADS];
+    char      big[KLOG_TEXT * 3 + 5];
+    size_t    records;
+
+    klog_out = malloc(( size_t )KLOG_THREADS * KLOG_MSGS * 16 + 4096);
+    if (!klog_out) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    /* A write longer than a record comes back in one piece */
+    klog_out_len = 0;
+    rnd_fill(( unsigned char * )big, sizeof(big));
+    k_klog_write(big, sizeof(big));
+    records = k_klog_drain(klog_collect);
+    if (records != 4 || klog_out_len != sizeof(big) ||
+        memcmp(klog_out, big, sizeof(big)))
+        FAIL("klog", "long write: %zu records, %zu bytes", records,
+             klog_out_len);
+
+    /* Lapping the drain loses the oldest records and says so */
+    klog_out_len = 0;
+    for (int i = 0; i < KLOG_SLOTS + 10; ++i)
+        k_klog_write(i < 10 ? "old\n" : "new\n", 4);
+    records = k_klog_drain(klog_collect);
+    klog_out[klog_out_len] = '\0';
+    if (records != KLOG_SLOTS ||
+        strncmp(klog_out, "[klog] 10 records lost\nnew\n", 27))
+        FAIL("klog", "overrun: %zu records \"%.30s\"", records, klog_out);
+
+    /* Producers racing a drain that keeps up as best it can */
+    klog_out_len = 0;
+    for (int t = 0; t < KLOG_THREADS; ++t)
+        pthread_create(&threads[t], NULL, klog_producer,
+                       ( void * )( intptr_t )t);
+    for (int t = 0; t < KLOG_THREADS; ++t) {
+        while (pthread_tryjoin_np(threads[t], NULL))
+            k_klog_drain(klog_collect);
+    }
+    k_klog_drain(klog_collect);
+    check_klog_lines();
+
+    free(klog_out);
+}
+
+/* Strip the "[tsc] cpuN: " prefix from each dumped line and check the time
+ * stamps never go backwards */
+static char *trace_text(char *out, size_t len)
+{
+    char              *line = out, *dst = out, *end = out + len;
+    unsigned long long last = 0, tsc;
+    unsigned           cpu;
+    int                skip;
+
+    while (line < end) {
+        char *nl = memchr(line, '\n', ( size_t )(end - line));
+        /* Not "%u: %n", the space would eat the text's leading blanks */
+        if (sscanf(line, "[%llu] cpu%u:%n", &tsc, &cpu, &skip) != 2 || !nl ||
+            line[skip++] != ' ' || cpu >= TRACE_CPUS || tsc < last) {
+            FAIL("trace", "bad line \"%.40s\"", line);
+            break;
+        }
+        last = tsc;
+        memmove(dst, line + skip, ( size_t )(nl + 1 - line - skip));
+        dst  += nl + 1 - line - skip;
+        line  = nl + 1;
+    }
+    *dst = '\0';
+    return out;
+}
+
+static void test_trace(void)
+{
+    char   want[256];
+    size_t records;
+
+    klog_out = malloc(TRACE_SLOTS * 64);
+    if (!klog_out) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    klog_out_len = 0;
+    trace_printf("plain");
+    trace_printf("irq %d at %p\n", -5, ( void * )0x1000);
+    trace_printf("%s %u %#x %ld %c", "str", 7u, 0xABCu, -9L, 'q');
+    trace_printf("%*d|%-5s|", 6, 42, "ab");
+    records = k_trace_dump(klog_collect);
+    snprintf(want, sizeof(want), "plain\nirq -5 at %p\nstr 7 0xabc -9 q\n"
+                                 "    42|ab   |\n",
+             ( void * )0x1000);
+    if (records != 4 || strcmp(trace_text(klog_out, klog_out_len), want))
+        FAIL("trace", "got %zu records \"%s\"", records, klog_out);
+
+    /* Dumped records are consumed */
+    klog_out_len = 0;
+    if (k_trace_dump(klog_collect) != 0 || klog_out_len)
+        FAIL("trace", "records dumped twice");
+
+    /* Lapping the reader drops the oldest records */
+    klog_out_len = 0;
+    for (unsigned i = 0; i < TRACE_SLOTS + 10; ++i)
+        trace_printf("%u", i);
+    records = k_trace_dump(klog_collect);
+    trace_text(klog_out, klog_out_len);
+    if (records != TRACE_SLOTS || strncmp(klog_out, "10\n11\n", 6))
+        FAIL("trace", "overrun: %zu records \"%.12s\"", records, klog_out);
+
+    free(klog_out);
+}
+
+static void test_kprint(void)
+{
+    char          want[1024], path[300];
+    long          neg  = -1234567890123L;
+    unsigned long big  = ~0ul;
+    void         *ptr  = ( void * )0xFFFF800000001000ul;
+    const char   *null = NULL;
+    char          ch   = 'c';
+
+    klog_out = malloc(4096);
+    if (!klog_out) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    klog_out_len = 0;
+    kprint("int ", -42, " uint ", 42u, " long ", neg, " ulong ", big,
+           " char ", ch, " int ", 'c');
+    kprint(" hex ", kp_hex(0xDEADBEEFCAFEul), " w ", kp_hexw(0xAB, 8),
+           " ptr ", ptr, " null ", null, "\n");
+    k_klog_drain(klog_collect);
+    klog_out[klog_out_len] = '\0';
+    snprintf(want, sizeof(want),
+             "int -42 uint 42 long %ld ulong %lu char c int 99 hex "
+             "deadbeefcafe w 000000ab ptr %p null (null)\n",
+             neg, big, ptr);
+    if (strcmp(klog_out, want))
+        FAIL("kprint", "got \"%s\" want \"%s\"", klog_out, want);
+
+    /* Output past the stack buffer is flushed early, not dropped */
+    klog_out_len = 0;
+    memset(path, 'p', sizeof(path) - 1);
+    path[sizeof(path) - 1] = '\0';
+    kprint(path, "/", path, " ", 7);
+    k_klog_drain(klog_collect);
+    klog_out[klog_out_len] = '\0';
+    snprintf(want, sizeof(want), "%s/%s 7", path, path);
+    if (strcmp(klog_out, want))
+        FAIL("kprint", "long output: %zu bytes", klog_out_len);
+
+    free(klog_out);
+}
+
+struct sink {
+    struct console con;
+    char           buf[KLOG_SLOTS * 16];
+    size_t         len;
+};
+
+static struct sink sink_a, sink_b;
+
+static void sink_put(struct sink *s, const char *data, size_t size)
+{
+    if (size > sizeof(s->buf) - 1 - s->len)
+        size = sizeof(s->buf) - 1 - s->len;
+    memcpy(s->buf + s->len, data, size);
+    s->len         += size;
+    s->buf[s->len]  = '\0';
+}
+
+static void sink_a_write(const char *data, size_t size)
+{
+    sink_put(&sink_a, data, size);
+}
+
+static void sink_b_write(const char *data, size_t size)
+{
+    sink_put(&sink_b, data, size);
+}
+
+static void sinks_reset(void)
+{
+    sink_a.len = sink_b.len = 0;
+    sink_a.buf[0] = sink_b.buf[0] = '\0';
+}
+
+static void test_console(void)
+{
+    char line[16];
+
+    /* Registered once, the tests run for every binding */
+    if (!sink_a.con.name) {
+        sink_a.con.name  = "a";
+        sink_a.con.write = sink_a_write;
+        sink_b.con.name  = "b";
+        sink_b.con.write = sink_b_write;
+        k_console_register(&sink_a.con);
+        k_console_register(&sink_b.con);
+    }
+
+    /* Every console sees the log */
+    k_console_drain();
+    sinks_reset();
+    k_klog_write("both\n", 5);
+    k_console_drain();
+    if (strcmp(sink_a.buf, "both\n") || strcmp(sink_b.buf, "both\n"))
+        FAIL("console", "drain: \"%s\" \"%s\"", sink_a.buf, sink_b.buf);
+
+    /* Only the selected ones see output */
+    sinks_reset();
+    k_console_parse_cmdline("quiet console=host,a noavx2");
+    k_puts("puts\n");
+    k_console_select("", 0);
+    if (strcmp(sink_a.buf, "puts\n") || sink_b.len)
+        FAIL("console", "select: \"%s\" \"%s\"", sink_a.buf, sink_b.buf);
+
+    /* A console left behind loses records without holding the others back */
+    k_console_select("host,a", 6);
+    sinks_reset();
+    for (unsigned i = 0; i < KLOG_SLOTS + 44; ++i) {
+        snprintf(line, sizeof(line), "%u\n", i);
+        k_klog_write(line, strlen(line));
+        if (i == KLOG_SLOTS / 2)
+            k_console_drain();
+    }
+    k_console_drain();
+    k_console_select("", 0);
+    k_console_drain();
+    if (strncmp(sink_a.buf, "0\n1\n", 4) ||
+        strncmp(sink_b.buf, "[klog] 44 records lost\n44\n", 26))
+        FAIL("console", "lapped: \"%.8s\" \"%.26s\"", sink_a.buf,
+             sink_b.buf);
+    console_reset();
+}
+
+/* gfx kernels against plain scalar versions of each pixel operation. Rows
+ * run through the row kernels at every length and alignment, rectangles
+ * through the clipping, overlap and format pair handling above them. The
+ * whole destination buffer is compared so stray writes are caught. */
+#define GFX_AREA   4096 /* Pixels in each buffer */
+#define GFX_ROW    300
+#define GFX_ROUNDS (ROUNDS / 4)
+
+static uint32_t gfx_src[GFX_AREA], gfx_dst[GFX_AREA], gfx_want[GFX_AREA];
+
+static uint32_t ref_blend(uint32_t s, uint32_t d)
+{
+    uint32_t a = s >> 24, p = 0;
+
+    for (unsigned sh = 0; sh < 32; sh += 8) {
+        uint32_t x = ((s >> sh) & 0xFF) * a + ((d >> sh) & 0xFF) * (255 - a);
+        p |= ((x * 2 + 255) / 510) << sh;
+    }
+    return p;
+}
+
+static uint32_t ref_load(const uint8_t *p, enum gfx_format format,
+                         const uint32_t *palette)
+{
+    uint32_t v = p[0] | ( uint32_t )p[1] << 8, r, g, b;
+
+    switch (format) {
+    case GFX_XRGB8888:
+        return v | ( uint32_t )p[2] << 16 | ( uint32_t )p[3] << 24;
+    case GFX_RGB888:
+        return 0xFF000000u | v | ( uint32_t )p[2] << 16;
+    case GFX_RGB565:
+        r = v >> 11, g = (v >> 5) & 0x3F, b = v & 0x1F;
+        return 0xFF000000u | (r << 3 | r >> 2) << 16 | (g << 2 | g >> 4) << 8 |
+               (b << 3 | b >> 2);
+    default:
+        return palette[p[0]];
+    }
+}
+
+static void ref_store(uint8_t *p, enum gfx_format format, uint32_t x)
+{
+    uint32_t r = (x >> 16) & 0xFF, g = (x >> 8) & 0xFF, b = x & 0xFF;
+
+    switch (format) {
+    case GFX_XRGB8888:
+        p[3] = ( uint8_t )(x >> 24);
+        /* fallthrough */
+    case GFX_RGB888:
+        p[0] = ( uint8_t )b, p[1] = ( uint8_t )g, p[2] = ( uint8_t )r;
+        break;
+    case GFX_RGB565:
+        x    = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+        p[0] = ( uint8_t )x, p[1] = ( uint8_t )(x >> 8);
+        break;
+    default:
+        p[0] = ( uint8_t )((r >> 5) << 5 | (g >> 5) << 2 | b >> 6);
+        break;
+    }
+}
+
+/* Pixels come in runs of one kind, so vector blocks are seen whole keyed,
+ * transparent or opaque as well as mixed */
+static void rnd_pixels(uint32_t *p, size_t n, uint32_t key)
+{
+    uint64_t kind = 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t r = ( uint32_t )rnd();
+        if (i % 8 == 0)
+            kind = rnd() % 4;
+        p[i] = kind == 0   ? key | (r & 0xFF000000u)
+               : kind == 1 ? r & 0x00FFFFFFu
+               : kind == 2 ? r | 0xFF000000u
+                           : r;
+    }
+}
+
+static void check_gfx(const char *name, size_t a, size_t b, size_t n)
+{
+    if (memcmp(gfx_dst, gfx_want, sizeof(gfx_dst)) != 0)
+        FAIL(name, "a=%zu b=%zu n=%zu", a, b, n);
+}
+
+static void test_gfxrows(void)
+{
+    for (int r = 0; r < GFX_ROUNDS; ++r) {
+        size_t   n = rnd() % GFX_ROW, a = rnd() % 16, b = rnd() % 16;
+        uint32_t key = ( uint32_t )rnd() & 0xFFFFFF, pixel = ( uint32_t )rnd();
+
+        rnd_fill(( unsigned char * )gfx_dst, sizeof(gfx_dst));
+        rnd_pixels(gfx_src + b, n, key);
+        memcpy(gfx_want, gfx_dst, sizeof(gfx_dst));
+
+        for (size_t i = 0; i < n; ++i)
+            gfx_want[a + i] = pixel;
+        k_gfx_fill32(gfx_dst + a, pixel, n);
+        check_gfx("gfx_fill32", a, 0, n);
+
+        for (size_t i = 0; i < n; ++i)
+            if ((gfx_src[b + i] ^ key) & 0xFFFFFF)
+                gfx_want[a + i] = gfx_src[b + i];
+        k_gfx_key32(gfx_dst + a, gfx_src + b, n, key);
+        check_gfx("gfx_key32", a, b, n);
+
+        for (size_t i = 0; i < n; ++i)
+            gfx_want[a + i] = ref_blend(gfx_src[b + i], gfx_want[a + i]);
+        k_gfx_blend32(gfx_dst + a, gfx_src + b, n);
+        check_gfx("gfx_blend32", a, b, n);
+
+        /* Overlapping both ways */
+        memmove(gfx_want + a, gfx_want + b, n * 4);
+        k_gfx_copy32(gfx_dst + a, gfx_dst + b, n);
+        check_gfx("gfx_copy32", a, b, n);
+    }
+}
+
+/* A surface of random size and format over buf, with slack in the pitch */
+static struct gfx_surface rnd_surface(void *buf, const uint32_t *palette)
+{
+    struct gfx_surface s = {.pixels  = buf,
+                            .width   = ( uint32_t )(rnd() % 100),
+                            .height  = ( uint32_t )(rnd() % 24),
+                            .format  = ( enum gfx_format )(rnd() % 4),
+                            .palette = palette};
+    s.pitch = s.width * k_gfx_bytes(s.format) + rnd() % 8;
+    return s;
+}
+
+static void test_gfxrects(void)
+{
+    uint32_t palette[256];
+
+    k_gfx_palette332(palette);
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint8_t idx;
+        ref_store(&idx, GFX_INDEXED8, palette[i]);
+        if (idx != i)
+            FAIL("gfx_palette332", "%u maps back to %u", i, idx);
+    }
+    for (uint32_t i = 0; i < 256; ++i)
+        palette[i] = ( uint32_t )rnd();
+
+    for (int r = 0; r < GFX_ROUNDS; ++r) {
+        struct gfx_surface d = rnd_surface(gfx_dst, palette);
+        struct gfx_surface s = rnd_surface(gfx_src, palette);
+        uint8_t           *wp = ( uint8_t * )gfx_want;
+        const uint8_t     *sp = s.pixels;
+        size_t             db = k_gfx_bytes(d.format);
+        size_t             sb = k_gfx_bytes(s.format);
+        int      x = ( int )(rnd() % 100) - 16, y = ( int )(rnd() % 32) - 8;
+        int      u = ( int )(rnd() % 100) - 16, v = ( int )(rnd() % 32) - 8;
+        uint32_t w = ( uint32_t )(rnd() % 100), h = ( uint32_t )(rnd() % 24);
+        uint32_t pixel = ( uint32_t )rnd();
+
+        rnd_fill(( unsigned char * )gfx_dst, sizeof(gfx_dst));
+        rnd_fill(( unsigned char * )gfx_src, sizeof(gfx_src));
+
+        /* Fill, clipped to the surface */
+        memcpy(gfx_want, gfx_dst, sizeof(gfx_dst));
+        for (int64_t j = y; j < ( int64_t )y + h; ++j)
+            for (int64_t i = x; i < ( int64_t )x + w; ++i)
+                if (i >= 0 && j >= 0 && i < d.width && j < d.height)
+                    memcpy(wp + j * d.pitch + i * db, &pixel, db);
+        k_gfx_fill(&d, x, y, w, h, pixel);
+        check_gfx("gfx_fill", ( size_t )x, ( size_t )y, w);
+
+        /* Conversion between any two formats, clipped to both surfaces */
+        for (int64_t j = 0; j < h; ++j)
+            for (int64_t i = 0; i < w; ++i) {
+                int64_t dx = x + i, dy = y + j, sx = u + i, sy = v + j;
+                if (dx < 0 || dy < 0 || dx >= d.width || dy >= d.height ||
+                    sx < 0 || sy < 0 || sx >= s.width || sy >= s.height)
+                    continue;
+                if (d.format == s.format)
+                    memcpy(wp + dy * d.pitch + dx * db,
+                           sp + sy * s.pitch + sx * sb, db);
+                else
+                    ref_store(wp + dy * d.pitch + dx * db, d.format,
+                              ref_load(sp + sy * s.pitch + sx * sb,
+                                       s.format, palette));
+            }
+        if (k_gfx_convert(&d, x, y, &s, u, v, w, h))
+            FAIL("gfx_convert", "%u to %u refused", s.format, d.format);
+        check_gfx("gfx_convert", s.format, d.format, w);
+
+        /* A block moved within one surface, as if through a temporary */
+        memcpy(gfx_src, gfx_dst, sizeof(gfx_dst));
+        for (int64_t j = 0; j < h; ++j)
+            for (int64_t i = 0; i < w; ++i) {
+                int64_t dx = x + i, dy = y + j, sx = u + i, sy = v + j;
+                if (dx < 0 || dy < 0 || dx >= d.width || dy >= d.height ||
+                    sx < 0 || sy < 0 || sx >= d.width || sy >= d.height)
+                    continue;
+                memcpy(wp + dy * d.pitch + dx * db,
+                       ( uint8_t * )gfx_src + sy * d.pitch + sx * db, db);
+            }
+        k_gfx_blit(&d, x, y, &d, u, v, w, h);
+        check_gfx("gfx_blit", ( size_t )x, ( size_t )u, w);
+    }
+}
+
+static const struct {
+    const char *name;
+    void (*run)(void);
+    int dispatched; /* Goes through libk_ops, so run under every binding */
+} tests[] = {
+        {"memset",   test_memset,   1},
+        {"memcpy",   test_memcpy,   1},
+        {"memmove",  test_memmove,  1},
+        {"memcmp",   test_memcmp,   1},
+        {"memvacmp", test_memvacmp, 0},
+        {"strings",  test_strings,  1},
+        {"gfxrows",  test_gfxrows,  1},
+        {"gfxrects", test_gfxrects, 1},
+        {"itoa",     test_itoa,     0},
+        {"printf",   test_printf,   1},
+        {"klog",     test_klog,     0},
+        {"trace",    test_trace,    0},
+        {"kprint",   test_kprint,   0},
+        {"console",  test_console,  0},
+};
+
+int main(int argc, char **argv)
+{
+    long           page = sysconf(_SC_PAGESIZE);
+    unsigned char *map;
+
+    if (argc > 1)
+        rng_state = strtoull(argv[1], NULL, 0) | 1;
+
+    map = mmap(NULL, 2 * page, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED || mprotect(map + page, page, PROT_NONE)) {
+        perror("mmap");
+        return EXIT_FAILURE;
+    }
+    guard_end = map + page;
+    k_console_register(&host_console);
+
+    for (size_t t = 0; t < ARRAY_LEN(tests); ++t) {
+        unsigned before = failures;
+        for (size_t v = 0; v < nvariants; ++v) {
+            if (!variant_supported(&variants[v]))
+                continue;
+            binding = variants[v].name;
+            k_libk_dispatch(variants[v].features);
+            tests[t].run();
+            if (!tests[t].dispatched)
+                break;
+        }
+        printf("%-10s %s\n", tests[t].name, failures == before ? "ok" : "FAIL");
+    }
+
+    munmap(map, 2 * page);
+    if (failures)
+        printf("%u failures\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
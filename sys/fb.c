@@ -0,0 +1,470 @@
+/* fb.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/kprint.h>
+
+#include <kernel/fb.h>
+#include <kernel/vesa.h>
+#include <kernel/x86/paging.h>
+
+typedef uint16_t u16_u __attribute__((__aligned__(1), __may_alias__));
+typedef uint32_t u32_u __attribute__((__aligned__(1), __may_alias__));
+
+struct fb fb_screen;
+
+static void put8(uint8_t *dst, uint32_t pixel) { *dst = ( uint8_t )pixel; }
+
+static void put16(uint8_t *dst, uint32_t pixel)
+{
+    *( u16_u * )dst = ( uint16_t )pixel;
+}
+
+static void put24(uint8_t *dst, uint32_t pixel)
+{
+    dst[0] = ( uint8_t )pixel;
+    dst[1] = ( uint8_t )(pixel >> 8);
+    dst[2] = ( uint8_t )(pixel >> 16);
+}
+
+static void put32(uint8_t *dst, uint32_t pixel) { *( u32_u * )dst = pixel; }
+
+static void span8(uint8_t *dst, uint32_t pixel, size_t count)
+{
+    memset(dst, ( int )( uint8_t )pixel, count);
+}
+
+static void span16(uint8_t *dst, uint32_t pixel, size_t count)
+{
+    u16_u *p = ( u16_u * )dst;
+    for (size_t i = 0; i < count; ++i)
+        p[i] = ( uint16_t )pixel;
+}
+
+/* Four pixels are exactly three words, so the span goes out a word at a time
+ * with the pattern rotating through w0 w1 w2 */
+static void span24(uint8_t *dst, uint32_t pixel, size_t count)
+{
+    const uint32_t p  = pixel & 0xFFFFFF;
+    const uint32_t w0 = p | (p << 24);
+    const uint32_t w1 = (p >> 8) | (p << 16);
+    const uint32_t w2 = (p >> 16) | (p << 8);
+
+    for (; count >= 4; count -= 4, dst += 12) {
+        (( u32_u * )dst)[0] = w0;
+        (( u32_u * )dst)[1] = w1;
+        (( u32_u * )dst)[2] = w2;
+    }
+    for (; count; --count, dst += 3)
+        put24(dst, p);
+}
+
+static void span32(uint8_t *dst, uint32_t pixel, size_t count)
+{
+    gfx_fill32(( uint32_t * )dst, pixel, count);
+}
+
+static const struct fb_ops fb_ops8  = {put8, span8};
+static const struct fb_ops fb_ops16 = {put16, span16};
+static const struct fb_ops fb_ops24 = {put24, span24};
+static const struct fb_ops fb_ops32 = {put32, span32};
+
+int fb_init(const struct multiboot_tag_framebuffer *tag)
+{
+    struct fb           *fb = &fb_screen;
+    const struct fb_ops *ops;
+    uint8_t             *base;
+
+    if (tag->common.framebuffer_type == MULTIBOOT_FRAMEBUFFER_TYPE_EGA_TEXT)
+        return -1;
+    switch (tag->common.framebuffer_bpp) {
+    case 8:
+        ops = &fb_ops8;
+        break;
+    case 15:
+    case 16:
+        ops = &fb_ops16;
+        break;
+    case 24:
+        ops = &fb_ops24;
+        break;
+    case 32:
+        ops = &fb_ops32;
+        break;
+    default:
+        return -1;
+    }
+
+    /* Pixels are only ever streamed out, so let the stores combine into
+     * full bursts instead of going out one at a time */
+    base = map_region(tag->common.framebuffer_addr,
+                      ( size_t )tag->common.framebuffer_pitch *
+                              tag->common.framebuffer_height,
+                      CACHE_WC);
+    if (!base)
+        return -1;
+
+    fb->base   = base;
+    fb->phys   = tag->common.framebuffer_addr;
+    fb->pitch  = tag->common.framebuffer_pitch;
+    fb->width  = tag->common.framebuffer_width;
+    fb->height = tag->common.framebuffer_height;
+    fb->bpp    = tag->common.framebuffer_bpp;
+    fb->bytes  = ( uint8_t )((fb->bpp + 7) / 8);
+    fb->type   = tag->common.framebuffer_type;
+
+    if (fb->type == MULTIBOOT_FRAMEBUFFER_TYPE_INDEXED) {
+        fb->palette_len = tag->framebuffer_palette_num_colors;
+        if (fb->palette_len > FB_PALETTE_MAX)
+            fb->palette_len = FB_PALETTE_MAX;
+        memcpy(fb->palette, tag->framebuffer_palette,
+               fb->palette_len * sizeof(fb->palette[0]));
+    } else {
+        fb->red_pos    = tag->framebuffer_red_field_position;
+        fb->red_size   = tag->framebuffer_red_mask_size;
+        fb->green_pos  = tag->framebuffer_green_field_position;
+        fb->green_size = tag->framebuffer_green_mask_size;
+        fb->blue_pos   = tag->framebuffer_blue_field_position;
+        fb->blue_size  = tag->framebuffer_blue_mask_size;
+    }
+
+    /* Set last, everything else goes by it to tell if the screen is up */
+    fb->ops = ops;
+    return 0;
+}
+
+/* Whether the channels are packed red, green, blue from the top down with
+ * these sizes and nothing below blue */
+static int fb_layout(const struct fb *fb, uint8_t rs, uint8_t gs, uint8_t bs)
+{
+    return fb->red_size == rs && fb->green_size == gs && fb->blue_size == bs &&
+           fb->red_pos == gs + bs && fb->green_pos == bs && fb->blue_pos == 0;
+}
+
+int fb_surface(const struct fb *fb, struct gfx_surface *s)
+{
+    enum gfx_format format;
+
+    if (fb->type != MULTIBOOT_FRAMEBUFFER_TYPE_RGB)
+        return -1;
+    if (fb->bpp == 32 && fb_layout(fb, 8, 8, 8))
+        format = GFX_XRGB8888;
+    else if (fb->bpp == 24 && fb_layout(fb, 8, 8, 8))
+        format = GFX_RGB888;
+    else if (fb->bpp == 16 && fb_layout(fb, 5, 6, 5))
+        format = GFX_RGB565;
+    else
+        return -1;
+
+    s->pixels  = fb->base;
+    s->pitch   = fb->pitch;
+    s->width   = fb->width;
+    s->height  = fb->height;
+    s->format  = format;
+    s->palette = NULL;
+    return 0;
+}
+
+/* The top `size` bits of an 8-bit channel, moved to `pos` */
+static uint32_t fb_field(uint8_t value, uint8_t pos, uint8_t size)
+{
+    if (!size)
+        return 0;
+    if (size > 8)
+        return ( uint32_t )value << (pos + size - 8);
+    return ( uint32_t )(value >> (8 - size)) << pos;
+}
+
+uint32_t fb_colour(const struct fb *fb, uint8_t r, uint8_t g, uint8_t b)
+{
+    uint32_t best = 0, best_distance = ~0u;
+
+    if (fb->type != MULTIBOOT_FRAMEBUFFER_TYPE_INDEXED)
+        return fb_field(r, fb->red_pos, fb->red_size) |
+               fb_field(g, fb->green_pos, fb->green_size) |
+               fb_field(b, fb->blue_pos, fb->blue_size);
+
+    for (uint32_t i = 0; i < fb->palette_len; ++i) {
+        const struct multiboot_color *c = &fb->palette[i];
+        int      dr = c->red - r, dg = c->green - g, db = c->blue - b;
+        uint32_t distance = ( uint32_t )(dr * dr + dg * dg + db * db);
+        if (distance < best_distance) {
+            best          = i;
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+static uint8_t *fb_at(const struct fb *fb, uint32_t x, uint32_t y)
+{
+    return fb->base + ( size_t )y * fb->pitch + ( size_t )x * fb->bytes;
+}
+
+static uint64_t rect_area(const struct fb_rect *r)
+{
+    return ( uint64_t )r->w * r->h;
+}
+
+static struct fb_rect rect_union(const struct fb_rect *a,
+                                 const struct fb_rect *b)
+{
+    uint32_t       x1 = a->x + a->w, y1 = a->y + a->h;
+    struct fb_rect u;
+
+    u.x = a->x < b->x ? a->x : b->x;
+    u.y = a->y < b->y ? a->y : b->y;
+    if (b->x + b->w > x1)
+        x1 = b->x + b->w;
+    if (b->y + b->h > y1)
+        y1 = b->y + b->h;
+    u.w = x1 - u.x;
+    u.h = y1 - u.y;
+    return u;
+}
+
+int fb_set_back(struct fb *fb, void *back)
+{
+    if (!back || fb->front)
+        return -1;
+
+    memcpy(back, fb->base, ( size_t )fb->pitch * fb->height);
+    fb->front      = fb->base;
+    fb->base       = back;
+    fb->damage_len = 0;
+    return 0;
+}
+
+void fb_damage(struct fb *fb, uint32_t x, uint32_t y, uint32_t w, uint32_t h)
+{
+    struct fb_rect r;
+
+    if (!fb->front || x >= fb->width || y >= fb->height || !w || !h)
+        return;
+    if (w > fb->width - x)
+        w = fb->width - x;
+    if (h > fb->height - y)
+        h = fb->height - y;
+    r = ( struct fb_rect ){x, y, w, h};
+
+    /* Most damage lands inside a rectangle already noted */
+    for (unsigned i = 0; i < fb->damage_len; ++i) {
+        const struct fb_rect *d = &fb->damage[i];
+        if (x >= d->x && y >= d->y && x + w <= d->x + d->w &&
+            y + h <= d->y + d->h)
+            return;
+    }
+
+    /* Fold r into any rectangle whose union with it covers no more than the
+     * two apart, and into the cheapest one if the list is full. Each fold
+     * shortens the list, so this ends. */
+    for (;;) {
+        unsigned best      = 0;
+        int64_t  best_cost = LONG_MAX;
+
+        for (unsigned i = 0; i < fb->damage_len && best_cost > 0; ++i) {
+            struct fb_rect u    = rect_union(&fb->damage[i], &r);
+            int64_t        cost = ( int64_t )(rect_area(&u) -
+                                              rect_area(&fb->damage[i]) -
+                                              rect_area(&r));
+            if (cost < best_cost) {
+                best      = i;
+                best_cost = cost;
+            }
+        }
+        if (best_cost > 0 && fb->damage_len < FB_DAMAGE_MAX)
+            break;
+
+        r                = rect_union(&fb->damage[best], &r);
+        fb->damage[best] = fb->damage[--fb->damage_len];
+    }
+    fb->damage[fb->damage_len++] = r;
+}
+
+void fb_present(struct fb *fb)
+{
+    for (unsigned i = 0; i < fb->damage_len; ++i) {
+        const struct fb_rect *d = &fb->damage[i];
+        size_t off = ( size_t )d->y * fb->pitch + ( size_t )d->x * fb->bytes;
+        size_t len = ( size_t )d->w * fb->bytes;
+
+        for (uint32_t row = 0; row < d->h; ++row, off += fb->pitch)
+            memcpy_nt(fb->front + off, fb->base + off, len);
+    }
+    fb->damage_len = 0;
+}
+
+void fb_put(struct fb *fb, uint32_t x, uint32_t y, uint32_t pixel)
+{
+    if (x < fb->width && y < fb->height) {
+        fb->ops->put(fb_at(fb, x, y), pixel);
+        fb_damage(fb, x, y, 1, 1);
+    }
+}
+
+void fb_span(struct fb *fb, uint32_t x, uint32_t y, uint32_t len,
+             uint32_t pixel)
+{
+    if (x >= fb->width || y >= fb->height)
+        return;
+    if (len > fb->width - x)
+        len = fb->width - x;
+    fb->ops->span(fb_at(fb, x, y), pixel, len);
+    fb_damage(fb, x, y, len, 1);
+}
+
+/* Whether the bytes of a pixel are all the same */
+static int fb_uniform(const struct fb *fb, uint32_t pixel)
+{
+    uint32_t mask = fb->bytes >= 4 ? 0xFFFFFFFF : (1u << (fb->bytes * 8)) - 1;
+    return ((pixel ^ (pixel & 0xFF) * 0x01010101) & mask) == 0;
+}
+
+void fb_fill(struct fb *fb, uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+             uint32_t pixel)
+{
+    uint8_t *row;
+
+    if (x >= fb->width || y >= fb->height)
+        return;
+    if (w > fb->width - x)
+        w = fb->width - x;
+    if (h > fb->height - y)
+        h = fb->height - y;
+    fb_damage(fb, x, y, w, h);
+
+    /* Whole rows of the screen itself, with every byte of the pixel alike as
+     * when clearing to black, are one streamed fill. Nothing reads a frame
+     * back, so there is no point in it taking over the cache. */
+    if (!fb->front && x == 0 && w == fb->width && fb_uniform(fb, pixel)) {
+        memset_nt(fb_at(fb, 0, y), ( int )( uint8_t )pixel,
+                  ( size_t )fb->pitch * h);
+        return;
+    }
+
+    for (row = fb_at(fb, x, y); h; --h, row += fb->pitch)
+        fb->ops->span(row, pixel, w);
+}
+
+void fb_blit(struct fb *fb, uint32_t x, uint32_t y, uint32_t w, uint32_t h,
+             const void *src, size_t src_pitch)
+{
+    const uint8_t *from = src;
+    uint8_t       *row;
+
+    if (x >= fb->width || y >= fb->height)
+        return;
+    if (w > fb->width - x)
+        w = fb->width - x;
+    if (h > fb->height - y)
+        h = fb->height - y;
+    fb_damage(fb, x, y, w, h);
+    for (row = fb_at(fb, x, y); h; --h, row += fb->pitch, from += src_pitch)
+        memcpy(row, from, ( size_t )w * fb->bytes);
+}
+
+#define FB_BENCH_FRAMES 16
+
+static int fb_bench_enabled;
+
+void fb_parse_cmdline(const char *cmdline)
+{
+    const char *word = cmdline;
+
+    while (*word) {
+        size_t len = 0;
+        while (word[len] && word[len] != ' ')
+            ++len;
+        if (len == 7 && !memcmp(word, "fbbench", 7))
+            fb_bench_enabled = 1;
+        word += len;
+        while (*word == ' ')
+            ++word;
+    }
+}
+
+/* The framebuffer's own mapping is switched to each memory type in turn
+ * and drawn through while it is being timed, then set back to WC. A second
+ * mapping with another type would alias the first. draw_moire() is timed
+ * after. */
+void fb_bench(struct fb *fb)
+{
+    static const struct {
+        const char     *name;
+        enum cache_type type;
+    } types[] = {
+            {"UC", CACHE_UC},
+            {"WC", CACHE_WC},
+    };
+    uint8_t *base   = fb->base, *front = fb->front;
+    uint8_t *screen = front ? front : base;
+    size_t   size   = ( size_t )fb->pitch * fb->height;
+
+    if (!fb_bench_enabled || !fb->ops)
+        return;
+    fb->base  = screen; /* Time the screen, not the back buffer */
+    fb->front = NULL;
+
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+        uint64_t tsc;
+
+        if (map_retype(screen, size, types[i].type))
+            continue;
+
+        tsc = __builtin_ia32_rdtsc();
+        for (unsigned n = 0; n < FB_BENCH_FRAMES; ++n)
+            fb_fill(fb, 0, 0, fb->width, fb->height,
+                    fb_colour(fb, ( uint8_t )(n * 16), 0, 0));
+        tsc = __builtin_ia32_rdtsc() - tsc;
+
+        kprint("[fb] ", types[i].name, " fill: ", tsc / FB_BENCH_FRAMES,
+               " cycles/frame\n");
+    }
+    map_retype(screen, size, CACHE_WC);
+
+    fb->base  = base;
+    fb->front = front;
+    fb_fill(fb, 0, 0, fb->width, fb->height, fb_colour(fb, 0, 0, 0));
+    fb_present(fb);
+
+    /* Lines, through the back buffer when there is one */
+    if (fb == &fb_screen) {
+        uint64_t tsc = __builtin_ia32_rdtsc();
+        for (unsigned n = 0; n < FB_BENCH_FRAMES; ++n)
+            draw_moire();
+        tsc = __builtin_ia32_rdtsc() - tsc;
+        kprint("[fb] moire: ", tsc / FB_BENCH_FRAMES, " cycles/frame\n");
+    }
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
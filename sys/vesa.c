@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <kernel/fb.h>
 #include <kernel/vesa.h>
 
 #include <stdio.h>
@@ -176,117 +177,220 @@ int set_vbe_bank(uint32_t bank)
 
 void put_pixel(uint32_t x, uint32_t y, uint32_t colour)
 {
-    uintptr_t addr = y * (bytes_per_line + x);
+    /* Draw to the multiboot2 framebuffer, through its back buffer, when the
+     * bootloader has set one up */
+    if (fb_screen.ops) {
+        fb_put(&fb_screen, x, y, colour);
+        return;
+    }
+
+    uintptr_t addr = ( uintptr_t )y * bytes_per_line + x;
     set_vbe_bank(( uint32_t )(addr >> 16));
     *(( uint8_t * )screen_ptr + (addr & 0xFFFF)) = ( uint8_t )colour;
 }
 
-void line(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint32_t colour)
+/* Cohen-Sutherland outcodes, which sides of the screen a point is beyond */
+#define CLIP_LEFT   (1 << 0)
+#define CLIP_RIGHT  (1 << 1)
+#define CLIP_TOP    (1 << 2)
+#define CLIP_BOTTOM (1 << 3)
+
+static unsigned clip_outcode(int64_t x, int64_t y, int64_t w, int64_t h)
+{
+    unsigned code = 0;
+
+    if (x < 0)
+        code |= CLIP_LEFT;
+    else if (x >= w)
+        code |= CLIP_RIGHT;
+    if (y < 0)
+        code |= CLIP_TOP;
+    else if (y >= h)
+        code |= CLIP_BOTTOM;
+    return code;
+}
+
+/* Clip the segment to [0, w) x [0, h) by moving whichever end is outside
+ * onto the edge it crosses, until both are in or both are beyond the same
+ * edge. Returns 0 when nothing of the line is on screen. */
+static int clip_line(int64_t *x1, int64_t *y1, int64_t *x2, int64_t *y2,
+                     int64_t w, int64_t h)
 {
-    uint32_t d;             /* Decicision vaiable */
-    uint32_t dx, dy;        /* Dx and Dy values for line */
-    uint32_t Eincr, NEincr; /* Decision variable increments */
-    uint32_t yincr;         /* Increment for y value */
-    uint32_t t;             /* Counters, Swaps, etc. */
-
-    dx = abs(x2 - x1);
-    dy = abs(y2 - y1);
-    if (dy <= dx) {
-        /* Line with a slope -1 <= s <= 1
-         *
-         * Ensure that we are always scan:
-         *      - converting the line from left to right
-         *        to ensure that we produce the same line
-         *        from P1 to P0 as the line from P0 to P1 */
-
-        /* Swap X and Y values */
-        if (x2 < x1) {
-            t  = x2;
-            x2 = x1;
-            x1 = t;
-            t  = y2;
-            y2 = y1;
-            y1 = t;
+    unsigned c1 = clip_outcode(*x1, *y1, w, h);
+    unsigned c2 = clip_outcode(*x2, *y2, w, h);
+
+    for (;;) {
+        unsigned c;
+        int64_t  x, y;
+
+        if (!(c1 | c2))
+            return 1;
+        if (c1 & c2)
+            return 0;
+
+        c = c1 ? c1 : c2;
+        if (c & CLIP_BOTTOM) {
+            y = h - 1;
+            x = *x1 + (*x2 - *x1) * (y - *y1) / (*y2 - *y1);
+        } else if (c & CLIP_TOP) {
+            y = 0;
+            x = *x1 + (*x2 - *x1) * (y - *y1) / (*y2 - *y1);
+        } else if (c & CLIP_RIGHT) {
+            x = w - 1;
+            y = *y1 + (*y2 - *y1) * (x - *x1) / (*x2 - *x1);
+        } else {
+            x = 0;
+            y = *y1 + (*y2 - *y1) * (x - *x1) / (*x2 - *x1);
         }
 
-        if (y2 > y1)
-            yincr = 1;
-        else
-            yincr = -1;
-
-        d      = (2 * dy) - dx;    /* Initialise deceision var */
-        Eincr  = 2 * dy;           /* Increment to move the E pixel */
-        NEincr = 2 * (dy - dx);    /* Incremeent to move the NE pixel */
-        put_pixel(x1, y1, colour); /* Draw the first point at x1, y1 */
-
-        /* Increment through rest of the points detereminend on the line */
-        for (x1++; x1 <= x2; x1++) {
-            if (d < 0)
-                d += Eincr;            /* Choose eastern pixel */
-            else {
-                d  += NEincr;          /*  Choose the north eastern pixel */
-                y1 += yincr;           /* (or south eastern for dx/dy < 0 ) */
+        if (c == c1) {
+            *x1 = x;
+            *y1 = y;
+            c1  = clip_outcode(x, y, w, h);
+        } else {
+            *x2 = x;
+            *y2 = y;
+            c2  = clip_outcode(x, y, w, h);
+        }
+    }
+}
+
+/* Bresenham over the linear framebuffer with a pixel pointer. Lines are
+ * always walked left to right, so P0-P1 and P1-P0 give the same pixels, and
+ * for shallow lines each run of pixels on a row goes out as one span. */
+static void line_fb(struct fb *fb, int64_t x1, int64_t y1, int64_t x2,
+                    int64_t y2, uint32_t colour)
+{
+    const struct fb_ops *ops   = fb->ops;
+    size_t               bytes = fb->bytes;
+    int64_t              step  = fb->pitch; /* To the next row of the line */
+    int64_t              dx, dy, d, t;
+    uint8_t             *p, *run;
+
+    if (x2 < x1) {
+        t  = x1, x1 = x2, x2 = t;
+        t  = y1, y1 = y2, y2 = t;
+    }
+    dx = x2 - x1;
+    dy = y2 - y1;
+    if (dy < 0) {
+        dy   = -dy;
+        step = -step;
+    }
+
+    fb_damage(fb, ( uint32_t )x1, ( uint32_t )(y1 < y2 ? y1 : y2),
+              ( uint32_t )dx + 1, ( uint32_t )dy + 1);
+    p = fb->base + ( size_t )y1 * fb->pitch + ( size_t )x1 * bytes;
+
+    if (!dy) {
+        ops->span(p, colour, ( size_t )dx + 1);
+        return;
+    }
+    if (!dx) {
+        for (; dy >= 0; --dy, p += step)
+            ops->put(p, colour);
+        return;
+    }
+
+    if (dx >= dy) {
+        d   = 2 * dy - dx;
+        run = p;
+        for (int64_t i = 0; i < dx; ++i) {
+            if (d > 0) {
+                ops->span(run, colour, ( size_t )(p - run) / bytes + 1);
+                p   += step;
+                run  = p + bytes;
+                d   -= 2 * dx;
             }
-            put_pixel(x1, y1, colour); /* draw point */
+            d += 2 * dy;
+            p += bytes;
         }
+        ops->span(run, colour, ( size_t )(p - run) / bytes + 1);
     } else {
-        /* Line with a slope including vertical lines and others not covered
-         *
-         * Ensure that we are always scan: - converting the line from left to
-         * right to ensure that we produce the same line from P1 to P0 as the
-         * line from P0 to P1 */
-
-        /* Swap X and Y values */
-        if (y2 < y1) {
-            t  = x2;
-            x2 = x1;
-            x1 = t;
-            t  = y2;
-            y2 = y1;
-            y1 = t;
+        d = 2 * dx - dy;
+        for (int64_t i = 0; i <= dy; ++i, p += step) {
+            ops->put(p, colour);
+            if (d > 0) {
+                p += bytes;
+                d -= 2 * dy;
+            }
+            d += 2 * dx;
         }
+    }
+}
 
-        if (x2 > x1)
-            yincr = 1;
-        else
-            yincr = -1;
-
-        d      = (2 * dx) - dy;    /* Initialise deceision var */
-        Eincr  = 2 * dx;           /* Increment to move the E pixel */
-        NEincr = 2 * (dx - dy);    /* Incremeent to move the NE pixel */
-        put_pixel(x1, y1, colour); /* Draw the first point at x1, y1 */
-
-        /* Increment through rest of the points detereminend on the line */
-        for (y1++; y1 <= y2; y1++) {
-            if (d < 0)
-                d += Eincr;            /* Choose eastern pixel */
-            else {
-                d  += NEincr;          /*  Choose the north eastern pixel */
-                x1 += yincr;           /* (or south eastern for dx/dy < 0 ) */
-            }
-            put_pixel(x1, y1, colour); /* draw point */
+/* The same walk for banked VBE modes, a pixel at a time through put_pixel()
+ * as the bank may change anywhere along the line */
+static void line_banked(int64_t x1, int64_t y1, int64_t x2, int64_t y2,
+                        uint32_t colour)
+{
+    int64_t dx = x2 > x1 ? x2 - x1 : x1 - x2;
+    int64_t dy = y2 > y1 ? y2 - y1 : y1 - y2;
+    int64_t sx = x2 > x1 ? 1 : -1;
+    int64_t sy = y2 > y1 ? 1 : -1;
+    int64_t err = dx - dy;
+
+    for (;;) {
+        put_pixel(( uint32_t )x1, ( uint32_t )y1, colour);
+        if (x1 == x2 && y1 == y2)
+            break;
+        if (2 * err > -dy) {
+            err -= dy;
+            x1  += sx;
         }
+        if (2 * err < dx) {
+            err += dx;
+            y1  += sy;
+        }
+    }
+}
+
+/* The size of whichever screen line() draws on */
+static void screen_size(uint32_t *w, uint32_t *h)
+{
+    if (fb_screen.ops) {
+        *w = fb_screen.width;
+        *h = fb_screen.height;
+    } else {
+        *w = x_resolution;
+        *h = y_resolution;
     }
 }
 
+void line(uint32_t x1, uint32_t y1, uint32_t x2, uint32_t y2, uint32_t colour)
+{
+    int64_t  ax = x1, ay = y1, bx = x2, by = y2;
+    uint32_t w, h;
+
+    screen_size(&w, &h);
+    if (!clip_line(&ax, &ay, &bx, &by, w, h))
+        return;
+
+    if (fb_screen.ops)
+        line_fb(&fb_screen, ax, ay, bx, by, colour);
+    else
+        line_banked(ax, ay, bx, by, colour);
+}
+
 /* Draw a simple moire pattern of lines on the display */
 void draw_moire(void)
 {
-    uint32_t i;
-    for (i = 0; i < x_resolution; i += 5) {
-        line(x_resolution / 2, y_resolution / 2, i, 0, i % 0xFF);
-        line(x_resolution / 2, y_resolution / 2, i, y_resolution,
-             (i + 1) % 0xFF);
+    uint32_t i, w, h;
+
+    screen_size(&w, &h);
+    for (i = 0; i < w; i += 5) {
+        line(w / 2, h / 2, i, 0, i % 0xFF);
+        line(w / 2, h / 2, i, h, (i + 1) % 0xFF);
     }
-    for (i = 0; i < y_resolution; i += 5) {
-        line(x_resolution / 2, y_resolution / 2, 0, i, (i + 2) % 0xFF);
-        line(x_resolution / 2, y_resolution / 2, x_resolution, i,
-             (i + 3) % 0xFF);
+    for (i = 0; i < h; i += 5) {
+        line(w / 2, h / 2, 0, i, (i + 2) % 0xFF);
+        line(w / 2, h / 2, w, i, (i + 3) % 0xFF);
     }
-    line(0, 0, x_resolution - 1, 0, 15);
-    line(0, 0, 0, y_resolution - 1, 15);
-    line(x_resolution - 1, 0, x_resolution - 1, y_resolution - 1, 15);
-    line(0, y_resolution - 1, x_resolution - 1, y_resolution - 1, 15);
+    line(0, 0, w - 1, 0, 15);
+    line(0, 0, 0, h - 1, 15);
+    line(w - 1, 0, w - 1, h - 1, 15);
+    line(0, h - 1, w - 1, h - 1, 15);
+    fb_present(&fb_screen);
 }
 
 void available_modes(void)
@@ -0,0 +1,170 @@
+/* cpu.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/dispatch.h>
+
+#include <kernel/x86/cpu.h>
+
+uint32_t cpu_features = CPU_FEATURE_SSE2; /* Architectural on x86_64 */
+
+/* The vector extensions that build on SSE2 */
+#define CPU_FEATURE_ABOVE_SSE2                                                 \
+        (CPU_FEATURE_SSSE3 | CPU_FEATURE_AVX | CPU_FEATURE_AVX2)
+
+/* `no<name>` on the command line masks the feature along with its
+ * dependents, so no variant stays bound without its prerequisite */
+static const struct {
+    const char      *name;
+    enum cpu_feature feature;
+    uint32_t         dependents;
+} cpu_feature_names[] = {
+        {"sse2",   CPU_FEATURE_SSE2,   CPU_FEATURE_ABOVE_SSE2},
+        {"ssse3",  CPU_FEATURE_SSSE3,  0                     },
+        {"popcnt", CPU_FEATURE_POPCNT, 0                     },
+        {"avx",    CPU_FEATURE_AVX,    CPU_FEATURE_AVX2      },
+        {"avx2",   CPU_FEATURE_AVX2,   0                     },
+        {"bmi2",   CPU_FEATURE_BMI2,   0                     },
+        {"erms",   CPU_FEATURE_ERMS,   0                     },
+        {"fsrm",   CPU_FEATURE_FSRM,   0                     },
+};
+
+#define CPU_FEATURE_NAMES                                                      \
+        (sizeof(cpu_feature_names) / sizeof(cpu_feature_names[0]))
+
+static inline uint64_t xgetbv(uint32_t idx)
+{
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(idx));
+    return (( uint64_t )hi << 32) | lo;
+}
+
+static inline void xsetbv(uint32_t idx, uint64_t val)
+{
+    __asm__ volatile("xsetbv"
+                     :
+                     : "c"(idx), "a"(( uint32_t )val),
+                       "d"(( uint32_t )(val >> 32)));
+}
+
+static inline uint64_t read_cr4(void)
+{
+    uint64_t cr4;
+    __asm__ volatile("mov %%cr4, %0" : "=r"(cr4));
+    return cr4;
+}
+
+static inline void write_cr4(uint64_t cr4)
+{
+    __asm__ volatile("mov %0, %%cr4" : : "r"(cr4) : "memory");
+}
+
+/* Probe CPUID once at boot, turn on the AVX register state if the CPU has
+ * it and bind the libk routines to the best implementation available */
+void cpu_init(void)
+{
+    uint32_t max, a, b, c, d;
+
+    cpuid(0, 0, &max, &b, &c, &d);
+
+    cpuid(1, 0, &a, &b, &c, &d);
+    if (d & CPUID_1_EDX_SSE2)
+        cpu_features |= CPU_FEATURE_SSE2;
+    if (c & CPUID_1_ECX_SSSE3)
+        cpu_features |= CPU_FEATURE_SSSE3;
+    if (c & CPUID_1_ECX_POPCNT)
+        cpu_features |= CPU_FEATURE_POPCNT;
+
+    /* AVX instructions #UD until CR4.OSXSAVE is set and XCR0 enables the
+     * upper halves of the ymm registers */
+    if ((c & CPUID_1_ECX_XSAVE) && (c & CPUID_1_ECX_AVX)) {
+        write_cr4(read_cr4() | CR4_OSXSAVE);
+        xsetbv(0, xgetbv(0) | XCR0_X87 | XCR0_SSE | XCR0_AVX);
+        if ((xgetbv(0) & (XCR0_SSE | XCR0_AVX)) == (XCR0_SSE | XCR0_AVX))
+            cpu_features |= CPU_FEATURE_AVX;
+    }
+
+    if (max >= 7) {
+        cpuid(7, 0, &a, &b, &c, &d);
+        if ((b & CPUID_7_EBX_AVX2) && (cpu_features & CPU_FEATURE_AVX))
+            cpu_features |= CPU_FEATURE_AVX2;
+        if (b & CPUID_7_EBX_BMI2)
+            cpu_features |= CPU_FEATURE_BMI2;
+        if (b & CPUID_7_EBX_ERMS)
+            cpu_features |= CPU_FEATURE_ERMS;
+        if (d & CPUID_7_EDX_FSRM)
+            cpu_features |= CPU_FEATURE_FSRM;
+    }
+
+    libk_dispatch(cpu_features);
+}
+
+/* Mask features named by `no<feature>` words on the kernel command line,
+ * e.g. "noavx2 noerms", and rebind libk. "noavx" takes AVX2 with it and
+ * "nosse2" every vector extension above SSE2. Together with the `-cpu` model
+ * QEMU is started with this lets every libk variant be forced and tested. */
+void cpu_parse_cmdline(const char *cmdline)
+{
+    const char *word = cmdline;
+
+    while (*word) {
+        size_t len = 0;
+        while (word[len] && word[len] != ' ')
+            ++len;
+        if (len > 2 && word[0] == 'n' && word[1] == 'o') {
+            for (size_t i = 0; i < CPU_FEATURE_NAMES; ++i) {
+                const char *name = cpu_feature_names[i].name;
+                if (strlen(name) == len - 2 &&
+                    !memcmp(name, word + 2, len - 2))
+                    cpu_features &= ~(cpu_feature_names[i].feature |
+                                      cpu_feature_names[i].dependents);
+            }
+        }
+        word += len;
+        while (*word == ' ')
+            ++word;
+    }
+
+    libk_dispatch(cpu_features);
+}
+
+void cpu_print_features(void)
+{
+    printf("[cpu] Features:");
+    for (size_t i = 0; i < CPU_FEATURE_NAMES; ++i)
+        if (cpu_features & cpu_feature_names[i].feature)
+            printf(" %s", cpu_feature_names[i].name);
+    printf("\n");
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -0,0 +1,63 @@
+/* debugcon.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/console.h>
+
+#include <kernel/debugcon.h>
+#include <kernel/x86/io.h>
+
+#define DEBUGCON_PORT 0xE9
+
+static struct console debugcon_console = {
+        .name  = "debugcon",
+        .write = debugcon_write,
+};
+
+/* The port reads back as 0xE9 when the emulator provides it */
+int debugcon_init(void)
+{
+    if (inb(DEBUGCON_PORT) != DEBUGCON_PORT)
+        return -1;
+    console_register(&debugcon_console);
+    return 0;
+}
+
+/* The whole span goes out with one string instruction */
+void debugcon_write(const char *data, size_t size)
+{
+    __asm__ volatile("rep outsb"
+                     : "+S"(data), "+c"(size)
+                     : "d"(( uint16_t )DEBUGCON_PORT)
+                     : "memory");
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
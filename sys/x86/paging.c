@@ -0,0 +1,273 @@
+/* paging.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <kernel/x86/cpu.h>
+#include <kernel/x86/paging.h>
+
+/* IA32_PAT memory type encodings */
+#define PAT_UC       0x00ul
+#define PAT_WC       0x01ul
+#define PAT_WT       0x04ul
+#define PAT_WP       0x05ul
+#define PAT_WB       0x06ul
+#define PAT_UC_MINUS 0x07ul
+
+#define PAT_ENTRY(i, type) ((type) << ((i) * 8))
+
+/* PA0-PA3 keep their power-on types, so PWT and PCD in the boot tables mean
+ * what they always did. WC goes in PA4, picked by the PAT bit alone. */
+#define PAT_VALUE                                                              \
+    (PAT_ENTRY(0, PAT_WB) | PAT_ENTRY(1, PAT_WT) |                             \
+     PAT_ENTRY(2, PAT_UC_MINUS) | PAT_ENTRY(3, PAT_UC) |                       \
+     PAT_ENTRY(4, PAT_WC) | PAT_ENTRY(5, PAT_WP) |                             \
+     PAT_ENTRY(6, PAT_UC_MINUS) | PAT_ENTRY(7, PAT_UC))
+
+#define CR0_NW (1ul << 29)
+#define CR0_CD (1ul << 30)
+
+#define PT_ENTRIES 512
+
+/* Device mappings are handed out from the first PML4 slot of the upper half,
+ * which nothing else uses */
+#define MAP_BASE 0xFFFF800000000000ul
+#define MAP_END  (MAP_BASE + (1ul << 39))
+
+/* Tables for the mappings come from here until there is a page allocator.
+ * 32 covers a few framebuffers and a good number of BARs. */
+#define MAP_TABLES 32
+
+static uint64_t map_tables[MAP_TABLES][PT_ENTRIES]
+        __attribute__((__aligned__(PAGE_SIZE)));
+static size_t   map_tables_used;
+static uint64_t map_next = MAP_BASE;
+static int      pat_enabled;
+
+/* PTE bits selecting each cache_type, for 4 KiB and 2 MiB pages */
+static const uint64_t cache_bits[][2] = {
+        [CACHE_WB] = {0,                 0                },
+        [CACHE_WT] = {PTE_PWT,           PTE_PWT          },
+        [CACHE_UC] = {PTE_PCD | PTE_PWT, PTE_PCD | PTE_PWT},
+        [CACHE_WC] = {PTE_PAT,           PTE_PAT_2M       },
+};
+
+static inline uint64_t read_cr0(void)
+{
+    uint64_t cr0;
+    __asm__ volatile("mov %%cr0, %0" : "=r"(cr0));
+    return cr0;
+}
+
+static inline void write_cr0(uint64_t cr0)
+{
+    __asm__ volatile("mov %0, %%cr0" : : "r"(cr0) : "memory");
+}
+
+static inline uint64_t read_cr3(void)
+{
+    uint64_t cr3;
+    __asm__ volatile("mov %%cr3, %0" : "=r"(cr3));
+    return cr3;
+}
+
+static inline void write_cr3(uint64_t cr3)
+{
+    __asm__ volatile("mov %0, %%cr3" : : "r"(cr3) : "memory");
+}
+
+static inline void wbinvd(void) { __asm__ volatile("wbinvd" : : : "memory"); }
+
+static inline void invlpg(uint64_t va)
+{
+    __asm__ volatile("invlpg (%0)" : : "r"(va) : "memory");
+}
+
+/* Caches and TLBs can hold lines typed by the old PAT, so it is changed
+ * with caching off and both flushed on either side, as the SDM lays out */
+void paging_init(void)
+{
+    uint32_t a, b, c, d;
+    uint64_t cr0;
+
+    cpuid(1, 0, &a, &b, &c, &d);
+    if (!(d & CPUID_1_EDX_PAT))
+        return;
+
+    cr0 = read_cr0();
+    write_cr0((cr0 | CR0_CD) & ~CR0_NW);
+    wbinvd();
+    write_cr3(read_cr3());
+    wrmsr(MSR_IA32_PAT, PAT_VALUE);
+    wbinvd();
+    write_cr3(read_cr3());
+    write_cr0(cr0);
+
+    pat_enabled = 1;
+}
+
+/* Tables from the pool are reached through the kernel image mapping, the
+ * ones boot.S built through the identity map of low memory */
+static uint64_t *table_virt(uint64_t phys)
+{
+    uint64_t pool = ( uint64_t )( uintptr_t )map_tables - KERNEL_VMA_OFFSET;
+
+    if (phys >= pool && phys < pool + sizeof(map_tables))
+        return map_tables[(phys - pool) / PAGE_SIZE];
+    return ( uint64_t * )( uintptr_t )phys;
+}
+
+/* The table entry points at, allocating and linking an empty one if the
+ * entry is not present. NULL if the pool is empty or the entry already maps
+ * a large page. */
+static uint64_t *table_next(uint64_t *entry)
+{
+    uint64_t *table;
+
+    if (*entry & PTE_P) {
+        if (*entry & PTE_PS)
+            return NULL;
+        return table_virt(*entry & PTE_ADDR);
+    }
+    if (map_tables_used == MAP_TABLES)
+        return NULL;
+
+    table  = map_tables[map_tables_used++];
+    *entry = (( uint64_t )( uintptr_t )table - KERNEL_VMA_OFFSET) | PTE_P |
+             PTE_W;
+    return table;
+}
+
+/* The entry mapping va at `level`, 1 for a page table, 2 for a page
+ * directory, with the tables above it filled in as needed */
+static uint64_t *table_entry(uint64_t va, int level)
+{
+    uint64_t *table = table_virt(read_cr3() & PTE_ADDR);
+    unsigned  shift;
+
+    for (shift = 39; shift > 12 + 9 * ( unsigned )(level - 1); shift -= 9) {
+        table = table_next(&table[(va >> shift) % PT_ENTRIES]);
+        if (!table)
+            return NULL;
+    }
+    return &table[(va >> shift) % PT_ENTRIES];
+}
+
+void *map_region(uint64_t phys, size_t len, enum cache_type type)
+{
+    uint64_t pa, end, va, base;
+    uint64_t *entry;
+
+    if (!len)
+        return NULL;
+    if (type == CACHE_WC && !pat_enabled)
+        type = CACHE_UC; /* PCD with PWT clear would be UC-, keep it strict */
+
+    pa  = phys & ~(PAGE_SIZE - 1);
+    end = (phys + len + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+
+    /* Keep va and pa congruent modulo 2 MiB, so the aligned middle of a
+     * large region can use large pages */
+    va = ((map_next + PAGE_SIZE_2M - 1) & ~(PAGE_SIZE_2M - 1)) +
+         (pa & (PAGE_SIZE_2M - 1));
+    if (va + (end - pa) > MAP_END)
+        return NULL;
+    base = va;
+
+    while (pa < end) {
+        if (!(pa & (PAGE_SIZE_2M - 1)) && end - pa >= PAGE_SIZE_2M) {
+            if (!(entry = table_entry(va, 2)))
+                return NULL;
+            *entry = pa | PTE_P | PTE_W | PTE_PS | cache_bits[type][1];
+            invlpg(va);
+            pa += PAGE_SIZE_2M;
+            va += PAGE_SIZE_2M;
+        } else {
+            if (!(entry = table_entry(va, 1)))
+                return NULL;
+            *entry = pa | PTE_P | PTE_W | cache_bits[type][0];
+            invlpg(va);
+            pa += PAGE_SIZE;
+            va += PAGE_SIZE;
+        }
+    }
+
+    map_next = va;
+    return ( void * )( uintptr_t )(base + (phys & (PAGE_SIZE - 1)));
+}
+
+/* The entry mapping va, a page table entry or a 2 MiB page directory entry
+ * as *large says, or NULL if va is not mapped or sits in a 1 GiB page */
+static uint64_t *table_find(uint64_t va, int *large)
+{
+    uint64_t *table = table_virt(read_cr3() & PTE_ADDR);
+    uint64_t *entry;
+
+    for (unsigned shift = 39;; shift -= 9) {
+        entry = &table[(va >> shift) % PT_ENTRIES];
+        if (!(*entry & PTE_P))
+            return NULL;
+        if (shift == 12 || (shift < 39 && (*entry & PTE_PS))) {
+            *large = shift == 21;
+            return shift > 21 ? NULL : entry;
+        }
+        table = table_virt(*entry & PTE_ADDR);
+    }
+}
+
+/* Lines and write-combining buffers filled under the old type are written
+ * back on both sides of the change, so no access ever sees two types for
+ * the same memory */
+int map_retype(void *addr, size_t len, enum cache_type type)
+{
+    uint64_t  va  = ( uint64_t )( uintptr_t )addr & ~(PAGE_SIZE - 1);
+    uint64_t  end = ( uint64_t )( uintptr_t )addr + len;
+    uint64_t *entry;
+    int       large;
+
+    if (type == CACHE_WC && !pat_enabled)
+        type = CACHE_UC;
+
+    wbinvd();
+    while (va < end) {
+        if (!(entry = table_find(va, &large)))
+            return -1;
+        *entry &= ~(PTE_PWT | PTE_PCD | (large ? PTE_PAT_2M : PTE_PAT));
+        *entry |= cache_bits[type][large];
+        invlpg(va);
+        va = large ? (va | (PAGE_SIZE_2M - 1)) + 1 : va + PAGE_SIZE;
+    }
+    wbinvd();
+    return 0;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
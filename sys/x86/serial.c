@@ -0,0 +1,251 @@
+/* serial.c
+ * Copyright 2025 h5law <dev@h5law.com>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS “AS IS”
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/console.h>
+#include <sys/numconv.h>
+
+#include <kernel/serial.h>
+#include <kernel/x86/io.h>
+
+#define COM1 0x3F8
+
+/* 16550 registers, as offsets from the base port */
+#define UART_DATA 0 /* THR, divisor low byte while LCR_DLAB is set */
+#define UART_IER  1 /* Divisor high byte while LCR_DLAB is set */
+#define UART_FCR  2
+#define UART_LCR  3
+#define UART_MCR  4
+#define UART_LSR  5
+#define UART_SCR  7
+
+#define IER_THRE   0x02 /* Interrupt when the transmitter empties */
+#define FCR_ENABLE 0x01
+#define FCR_CLEAR  0x06 /* Reset both FIFOs */
+#define FCR_TRIG14 0xC0
+#define LCR_8N1    0x03
+#define LCR_DLAB   0x80
+#define MCR_DTR    0x01
+#define MCR_RTS    0x02
+#define MCR_OUT2   0x08 /* Gates the UART's interrupt onto the IRQ line */
+#define LSR_THRE   0x20 /* With the FIFO on, all 16 slots are free */
+
+#define UART_FIFO      16
+#define SERIAL_DIVISOR 1 /* 115200 baud, the fastest the UART clock gives */
+#define SERIAL_RING    8192
+
+/* The ring between the writers and the interrupt. tx_head only moves in
+ * serial_write() and tx_tail only where the UART is fed, both free running.
+ * While IER_THRE is set the interrupt is the only thing feeding it. Writes
+ * wait on the line instead until serial_intr_enable() says the interrupt
+ * is delivered, otherwise the first FIFO's worth would be all that left. */
+static char     tx_ring[SERIAL_RING];
+static uint32_t tx_head;
+static uint32_t tx_tail;
+static size_t   tx_lost; /* Bytes that found the ring full */
+static uint8_t  serial_ier;
+static int      serial_ok;
+static int      serial_polled = 1;
+
+static struct console serial_console = {
+        .name  = "serial",
+        .write = serial_write,
+        .panic = serial_panic,
+};
+
+int serial_init(void)
+{
+    outb(COM1 + UART_IER, 0);
+    outb(COM1 + UART_LCR, LCR_DLAB);
+    outb(COM1 + UART_DATA, SERIAL_DIVISOR & 0xFF);
+    outb(COM1 + UART_IER, SERIAL_DIVISOR >> 8);
+    outb(COM1 + UART_LCR, LCR_8N1);
+    outb(COM1 + UART_FCR, FCR_ENABLE | FCR_CLEAR | FCR_TRIG14);
+    outb(COM1 + UART_MCR, MCR_DTR | MCR_RTS | MCR_OUT2);
+    /* A missing port reads back as all ones */
+    outb(COM1 + UART_SCR, 0x5A);
+    serial_ok = inb(COM1 + UART_SCR) == 0x5A;
+    if (!serial_ok)
+        return -1;
+    console_register(&serial_console);
+    return 0;
+}
+
+static void serial_set_ier(uint8_t ier)
+{
+    serial_ier = ier;
+    outb(COM1 + UART_IER, ier);
+}
+
+static int serial_thre(void) { return inb(COM1 + UART_LSR) & LSR_THRE; }
+
+/* Hand the UART up to a FIFO's worth from the ring, only called once the
+ * transmitter is empty */
+static void serial_fill(void)
+{
+    uint32_t tail = tx_tail;
+    uint32_t head = __atomic_load_n(&tx_head, __ATOMIC_ACQUIRE);
+
+    for (unsigned n = 0; n < UART_FIFO && tail != head; ++n, ++tail)
+        outb(COM1 + UART_DATA, ( uint8_t )tx_ring[tail % SERIAL_RING]);
+    __atomic_store_n(&tx_tail, tail, __ATOMIC_RELEASE);
+}
+
+/* Copy in as much as fits, with each "\n" sent as "\r\n" for the terminal on
+ * the other end. Returns how much of data was taken. */
+static size_t serial_queue(const char *data, size_t size)
+{
+    uint32_t head = tx_head;
+    uint32_t room = SERIAL_RING - (head - __atomic_load_n(&tx_tail,
+                                                          __ATOMIC_ACQUIRE));
+    size_t   done = 0;
+
+    while (done < size && room) {
+        const char *nl  = memchr(data + done, '\n', size - done);
+        size_t      run = nl ? ( size_t )(nl - (data + done)) : size - done;
+        size_t      at  = head % SERIAL_RING;
+
+        if (run > room)
+            run = room;
+        if (run > SERIAL_RING - at) {
+            memcpy(tx_ring + at, data + done, SERIAL_RING - at);
+            memcpy(tx_ring, data + done + (SERIAL_RING - at),
+                   run - (SERIAL_RING - at));
+        } else {
+            memcpy(tx_ring + at, data + done, run);
+        }
+        head += run;
+        room -= run;
+        done += run;
+        if (!nl || done < ( size_t )(nl - data) || room < 2)
+            break;
+        tx_ring[head++ % SERIAL_RING] = '\r';
+        tx_ring[head++ % SERIAL_RING] = '\n';
+        room -= 2;
+        ++done;
+    }
+    __atomic_store_n(&tx_head, head, __ATOMIC_RELEASE);
+    return done;
+}
+
+/* Start the transmitter if the interrupt is not already feeding it */
+static void serial_kick(void)
+{
+    if (serial_ier & IER_THRE)
+        return;
+    if (serial_thre())
+        serial_fill();
+    if (tx_tail != tx_head)
+        serial_set_ier(IER_THRE);
+}
+
+/* Wait on the line for every FIFO's worth, used once there is no interrupt */
+static void serial_poll(const char *data, size_t size)
+{
+    unsigned room = 0;
+
+    for (size_t i = 0; i < size; ++i) {
+        if (room < 2) {
+            while (!serial_thre())
+                __builtin_ia32_pause();
+            room = UART_FIFO;
+        }
+        if (data[i] == '\n') {
+            outb(COM1 + UART_DATA, '\r');
+            --room;
+        }
+        outb(COM1 + UART_DATA, ( uint8_t )data[i]);
+        --room;
+    }
+}
+
+void serial_write(const char *data, size_t size)
+{
+    size_t queued;
+
+    if (!serial_ok)
+        return;
+    if (serial_polled) {
+        serial_poll(data, size);
+        return;
+    }
+    /* Say how much went missing, once there is room to */
+    if (tx_lost) {
+        char   note[48] = "[serial] ";
+        size_t len      = 9;
+        len            += utostr(note + len, tx_lost, 10);
+        memcpy(note + len, " bytes lost\n", 12);
+        if (serial_queue(note, len + 12) == len + 12)
+            tx_lost = 0;
+    }
+    queued   = serial_queue(data, size);
+    tx_lost += size - queued;
+    serial_kick();
+}
+
+void serial_putchar(char c) { serial_write(&c, 1); }
+
+void serial_intr_enable(void)
+{
+    if (serial_ok)
+        serial_polled = 0;
+}
+
+void serial_intr(void)
+{
+    if (!serial_thre())
+        return;
+    serial_fill();
+    if (__atomic_load_n(&tx_head, __ATOMIC_ACQUIRE) == tx_tail)
+        serial_set_ier(0);
+}
+
+void serial_drain(void)
+{
+    if (!serial_ok)
+        return;
+    /* Take the ring off the interrupt so the two do not both feed it */
+    serial_set_ier(0);
+    while (tx_tail != tx_head) {
+        while (!serial_thre())
+            __builtin_ia32_pause();
+        serial_fill();
+    }
+}
+
+void serial_panic(void)
+{
+    serial_drain();
+    serial_polled = 1;
+}
+
+// vim: ft=c ts=4 sts=4 sw=4 et ai cin
@@ -31,171 +31,635 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include <sys/console.h>
 
 #include <kernel/vga.h>
+#include <kernel/x86/io.h>
 
 static const size_t       VGA_WIDTH  = 80;
 static const size_t       VGA_HEIGHT = 25;
 static volatile uint16_t *VGA_MEMORY = ( uint16_t * )0xC03FF000;
 
-static volatile uint16_t *vga_buffer;
-static size_t             vga_row;
-static size_t             vga_column;
-static uint8_t            vga_colour;
+#define VGA_CELLS (80 * 25)
 
-void vga_set_addr(uint16_t *addr) { VGA_MEMORY = addr; }
+/* CRT controller index/data ports and the registers the console drives */
+#define CRTC_INDEX     0x3D4
+#define CRTC_START_HI  0x0C
+#define CRTC_START_LO  0x0D
+#define CRTC_CURSOR_HI 0x0E
+#define CRTC_CURSOR_LO 0x0F
 
-void vga_clear(void)
+typedef uint64_t          u64_a __attribute__((__may_alias__));
+typedef volatile uint64_t vu64_a __attribute__((__may_alias__));
+
+/* Everything is drawn into a cacheable copy of the screen and only the cells
+ * that changed are pushed out to the (uncached, slow to read) VGA memory by
+ * vga_flush(). Per row, the cells in [dirty_lo, dirty_hi) differ from the
+ * screen, and dirty_rows has a bit set for each row with such a span. */
+static uint16_t vga_shadow[VGA_CELLS] __attribute__((__aligned__(64)));
+static uint8_t  dirty_lo[25];
+static uint8_t  dirty_hi[25];
+static uint32_t dirty_rows;
+
+/* The screen is rows [vga_top, vga_top + VGA_HEIGHT) of a window of
+ * vga_lines rows at VGA_MEMORY. When the window holds more than a screen,
+ * scrolling moves vga_top down and points the CRTC start address at it, so
+ * the rows above stay in VGA memory as scrollback. Reaching the end of the
+ * window the screen is repainted at its start. vga_back is how far the view
+ * has been scrolled back into that history. */
+static size_t vga_lines = 25;
+static size_t vga_top;
+static size_t vga_back;
+
+static size_t  vga_row;
+static size_t  vga_column; /* VGA_WIDTH while a wrap is pending */
+static uint8_t vga_colour;
+static uint8_t vga_base; /* From vga_setcolour(), what SGR 0 goes back to */
+
+/* Both halves of a 16-bit CRTC register, a port write each */
+static void vga_crtc(uint8_t hi_reg, uint8_t lo_reg, uint16_t val)
+{
+    outw(CRTC_INDEX, ( uint16_t )(hi_reg | (val & 0xFF00)));
+    outw(CRTC_INDEX, ( uint16_t )(lo_reg | (val << 8)));
+}
+
+static void vga_set_start(size_t row)
+{
+    vga_crtc(CRTC_START_HI, CRTC_START_LO, ( uint16_t )(row * VGA_WIDTH));
+}
+
+/* Only programmed when it moves. A pending wrap shows on the last column. */
+static void vga_cursor(void)
+{
+    static uint16_t at = 0xFFFF;
+    const size_t    x  = vga_column < VGA_WIDTH ? vga_column : VGA_WIDTH - 1;
+    const uint16_t  to = ( uint16_t )((vga_top + vga_row) * VGA_WIDTH + x);
+
+    if (to == at)
+        return;
+    at = to;
+    vga_crtc(CRTC_CURSOR_HI, CRTC_CURSOR_LO, to);
+}
+
+static void vga_dirty(size_t y, size_t lo, size_t hi)
+{
+    if (!(dirty_rows & (1u << y))) {
+        dirty_rows  |= 1u << y;
+        dirty_lo[y]  = ( uint8_t )lo;
+        dirty_hi[y]  = ( uint8_t )hi;
+        return;
+    }
+    if (lo < dirty_lo[y])
+        dirty_lo[y] = ( uint8_t )lo;
+    if (hi > dirty_hi[y])
+        dirty_hi[y] = ( uint8_t )hi;
+}
+
+static void vga_dirty_all(void)
 {
-    uint8_t prev_colour = vga_colour;
-    vga_row             = 0;
-    vga_column          = 0;
-    vga_colour = vga_entry_colour(VGA_COLOUR_LIGHT_GRAY, VGA_COLOUR_BLACK);
-    vga_buffer = VGA_MEMORY;
     for (size_t y = 0; y < VGA_HEIGHT; ++y) {
-        for (size_t x = 0; x < VGA_HEIGHT; ++x) {
-            const size_t idx = (y * VGA_WIDTH) + x;
-            vga_buffer[idx]  = vga_entry(' ', vga_colour);
+        dirty_lo[y] = 0;
+        dirty_hi[y] = ( uint8_t )VGA_WIDTH;
+    }
+    dirty_rows = (1u << VGA_HEIGHT) - 1;
+}
+
+/* Push every dirty span out to VGA memory. Spans are widened to whole
+ * 8-byte words, four cells, so each goes out as aligned 64-bit stores. */
+static void vga_flush_spans(void)
+{
+    uint32_t rows = dirty_rows;
+    dirty_rows    = 0;
+    while (rows) {
+        const size_t y    = ( size_t )__builtin_ctz(rows);
+        const size_t line = vga_top + y; /* Row of the window */
+        const u64_a *src  = ( const u64_a * )(vga_shadow + y * VGA_WIDTH);
+        vu64_a      *dst  = ( vu64_a * )(VGA_MEMORY + line * VGA_WIDTH);
+        for (size_t i = dirty_lo[y] / 4; i < (dirty_hi[y] + 3u) / 4; ++i)
+            dst[i] = src[i];
+        rows &= rows - 1;
+    }
+}
+
+/* Bring the screen up to date with the shadow and move the hardware cursor
+ * to where the next character goes. New output ends any scrollback view. */
+void vga_flush(void)
+{
+    if (dirty_rows) {
+        vga_flush_spans();
+        if (vga_back) {
+            vga_back = 0;
+            vga_set_start(vga_top);
         }
     }
-    vga_colour = prev_colour;
+    vga_cursor();
 }
 
-void vga_init(void) { vga_clear(); }
+/* Point the console at a one-screen buffer, it is redrawn in full on the next
+ * flush and scrolls by repainting */
+void vga_set_addr(uint16_t *addr) { vga_set_window(addr, VGA_CELLS * 2); }
 
+/* Point the console at a text window of size bytes mapping the start of text
+ * memory at 0xB8000, which is 32 KiB long and where the CRTC addresses count
+ * from. With room for more than one screen scrolling is done by the CRTC. */
+void vga_set_window(uint16_t *addr, size_t size)
+{
+    if (vga_top || vga_back)
+        vga_set_start(0);
+    VGA_MEMORY = addr;
+    vga_lines  = size / (VGA_WIDTH * sizeof(uint16_t));
+    vga_top    = 0;
+    vga_back   = 0;
+    vga_dirty_all();
+}
+
+/* Show the screen as it was rows lines of output ago, as far back as the
+ * window still holds. 0 returns to the live screen. */
+void vga_scrollback(size_t rows)
+{
+    if (rows > vga_top)
+        rows = vga_top;
+    vga_back = rows;
+    vga_set_start(vga_top - rows);
+}
+
+void vga_clear(void)
+{
+    const uint8_t  colour =
+            vga_entry_colour(VGA_COLOUR_LIGHT_GRAY, VGA_COLOUR_BLACK);
+    const uint16_t blank = vga_entry(' ', colour);
+    vga_row              = 0;
+    vga_column           = 0;
+    for (size_t i = 0; i < VGA_CELLS; ++i)
+        vga_shadow[i] = blank;
+    if (vga_top || vga_back)
+        vga_set_start(0);
+    vga_top  = 0;
+    vga_back = 0;
+    /* The screen is streamed out so clearing it does not evict the cache */
+    memcpy_nt(( uint16_t * )VGA_MEMORY, vga_shadow, sizeof(vga_shadow));
+    dirty_rows = 0;
+    vga_cursor();
+}
+
+static struct console vga_console = {.name = "vga", .write = vga_write};
+
+void vga_init(void)
+{
+    vga_clear();
+    console_register(&vga_console);
+}
+
+/* Also the colour SGR 0 and the default colour SGR codes return to */
 void vga_setcolour(uint8_t fg, uint8_t bg)
 {
     vga_colour = vga_entry_colour(fg, bg);
+    vga_base   = vga_colour;
 }
 
 void vga_putentry(unsigned char c, uint8_t colour, size_t x, size_t y)
 {
     const size_t idx = (y * VGA_WIDTH) + x;
-    vga_buffer[idx]  = vga_entry(c, colour);
+    vga_shadow[idx]  = vga_entry(c, colour);
+    vga_dirty(y, x, x + 1);
 }
 
 void vga_scroll(int line)
 {
-    volatile uint16_t *ptr;
-    for (size_t x = 0; x < VGA_WIDTH; ++x) {
-        ptr                = VGA_MEMORY + ((line * VGA_WIDTH) + x);
-        *(ptr - VGA_WIDTH) = *ptr;
-    }
+    memcpy(vga_shadow + ((line - 1) * VGA_WIDTH),
+           vga_shadow + (line * VGA_WIDTH), VGA_WIDTH * sizeof(uint16_t));
+    vga_dirty(( size_t )line - 1, 0, VGA_WIDTH);
 }
 
 void vga_delete_line(int line)
 {
-    volatile uint16_t *ptr;
-    for (size_t x = 0; x < VGA_WIDTH; ++x) {
-        ptr  = VGA_MEMORY + ((line * VGA_WIDTH) + x);
-        *ptr = 0;
-    }
+    memset(vga_shadow + (line * VGA_WIDTH), 0, VGA_WIDTH * sizeof(uint16_t));
+    vga_dirty(( size_t )line, 0, VGA_WIDTH);
 }
 
 void vga_delete_last_line(void) { vga_delete_line(VGA_HEIGHT - 1); }
 
-// void vga_special_character(char c)
-// {
-//     size_t line;
-//
-//     switch (c) {
-//     case '\0': /* Null character (0x00) */
-//         break;
-//
-//     case '\a': /* Bell (0x07) */
-//         /* Visual bell - ignore */
-//         break;
-//
-//     case '\b': /* Backspace (0x08) */
-//         if (vga_column > 0) {
-//             vga_column--;
-//             vga_putentry(' ', vga_colour, vga_column, vga_row);
-//         } else if (vga_row > 0) {
-//             vga_row--;
-//             vga_column = VGA_WIDTH - 1;
-//             while (vga_column > 0 &&
-//                    vga_buffer[(vga_column * VGA_WIDTH) + vga_row] == ' ') {
-//                 vga_column--;
-//             }
-//             if (vga_buffer[(vga_column * VGA_WIDTH) + vga_row] != ' ') {
-//                 vga_column++;
-//             }
-//         }
-//         break;
-//
-//     case '\t': /* Tab (0x09) */
-//         do {
-//             vga_putchar(' ');
-//         } while (vga_column % 8 != 0);
-//         break;
-//
-//     case '\n': /* Line Feed (0x0A) */
-//         vga_column = 0;
-//         if (++vga_row == VGA_HEIGHT) {
-//             for (line = 1; line < VGA_HEIGHT; ++line)
-//                 vga_scroll(line);
-//             vga_delete_last_line();
-//             vga_row = VGA_HEIGHT - 1;
-//         }
-//         break;
-//
-//     case '\v': /* Vertical Tab (0x0B) */
-//         if (++vga_row >= VGA_HEIGHT) {
-//             for (line = 1; line < VGA_HEIGHT; ++line)
-//                 vga_scroll(line);
-//             vga_delete_last_line();
-//             vga_row = VGA_HEIGHT - 1;
-//         }
-//         break;
-//
-//     case '\f': /* Form Feed (0x0C) */
-//         /* Clear screen and move to top-left */
-//         vga_clear();
-//         vga_row    = 0;
-//         vga_column = 0;
-//         break;
-//
-//     case '\r': /* Carriage Return (0x0D) */
-//         vga_column = 0;
-//         break;
-//
-//     case 0x1B: /* Escape (0x1B) */
-//         // TODO: Could be start of ANSI escape sequences? Ignore currently
-//         break;
-//
-//     default:
-//         /* Display as visible control character */
-//         if (c >= 0x01 && c <= 0x1F) {
-//             vga_putchar('^');
-//             vga_putchar('A' + c - 1); /* ^A for 0x01, ^B for 0x02, etc. */
-//         }
-//         break;
-//     }
-// }
-
-void vga_putchar(char c)
-{
-    size_t line;
-    // if (c <= 0x1F) {
-    //     vga_special_character(c);
-    //     return;
-    // }
-    vga_putentry(( unsigned char )c, vga_colour, vga_column, vga_row);
-    if (++vga_column == VGA_WIDTH) {
-        vga_column = 0;
-        if (++vga_row == VGA_HEIGHT) {
-            for (line = 1; line < VGA_HEIGHT; ++line)
-                vga_scroll(line);
-            vga_delete_last_line();
-            vga_row = VGA_HEIGHT - 1;
+/* Move to the start of the next row. Past the bottom the whole shadow moves
+ * up a row in one memmove. With a window to scroll through, the screen
+ * already shows all but the new blank row once the CRTC starts a row further
+ * on, otherwise every row is repainted on the next flush. */
+static void vga_newline(void)
+{
+    vga_column = 0;
+    if (++vga_row < VGA_HEIGHT)
+        return;
+    vga_row = VGA_HEIGHT - 1;
+
+    /* The top row leaves the screen as it stands */
+    if (vga_lines > VGA_HEIGHT)
+        vga_flush_spans();
+    memmove(vga_shadow, vga_shadow + VGA_WIDTH,
+            (VGA_CELLS - VGA_WIDTH) * sizeof(uint16_t));
+    memset(vga_shadow + (VGA_CELLS - VGA_WIDTH), 0,
+           VGA_WIDTH * sizeof(uint16_t));
+    if (vga_lines <= VGA_HEIGHT) {
+        vga_dirty_all();
+        return;
+    }
+
+    if (++vga_top + VGA_HEIGHT > vga_lines) {
+        vga_top = 0;
+        vga_dirty_all();
+    } else {
+        vga_dirty(VGA_HEIGHT - 1, 0, VGA_WIDTH);
+    }
+    if (!vga_back)
+        vga_set_start(vga_top);
+}
+
+/* Copy a run of printable bytes into the shadow a row at a time, so the cell
+ * index and the scroll check are worked out once per row instead of once per
+ * character. Filling the last column leaves the wrap pending until something
+ * is printed past it, so a full row followed by "\n" is one line, not two. */
+static void vga_put_run(const char *data, size_t size)
+{
+    const uint16_t attr = ( uint16_t )(( uint16_t )vga_colour << 8);
+
+    while (size) {
+        uint16_t *cell;
+        size_t    run;
+
+        if (vga_column == VGA_WIDTH)
+            vga_newline();
+        cell = vga_shadow + (vga_row * VGA_WIDTH) + vga_column;
+        run  = VGA_WIDTH - vga_column;
+        if (run > size)
+            run = size;
+        for (size_t i = 0; i < run; ++i)
+            cell[i] = attr | ( unsigned char )data[i];
+        vga_dirty(vga_row, vga_column, vga_column + run);
+        data       += run;
+        size       -= run;
+        vga_column += run;
+    }
+}
+
+/* Blank the cells [from, to) of the screen, counted row-major */
+static void vga_erase(size_t from, size_t to)
+{
+    const uint16_t blank = vga_entry(' ', vga_colour);
+
+    for (size_t i = from; i < to; ++i)
+        vga_shadow[i] = blank;
+    for (size_t y = from / VGA_WIDTH; y < VGA_HEIGHT && y * VGA_WIDTH < to;
+         ++y) {
+        size_t lo = y * VGA_WIDTH < from ? from - y * VGA_WIDTH : 0;
+        size_t hi = to - y * VGA_WIDTH < VGA_WIDTH ? to - y * VGA_WIDTH
+                                                   : VGA_WIDTH;
+        vga_dirty(y, lo, hi);
+    }
+}
+
+/* Control bytes and escape sequences go through a small state machine. Each
+ * byte is sorted into a class, and vga_fsm[state][class] gives the action to
+ * take and the state to move to. Only a subset of ECMA-48 is understood:
+ * SGR colours, cursor movement and erasing, enough for coloured log output.
+ * Anything else is dropped. */
+enum vga_state { ST_GROUND, ST_ESC, ST_CSI, ST_STATES };
+
+enum vga_class {
+    CL_PRINT,
+    CL_IGNORE, /* Other C0 controls */
+    CL_NL,     /* \n \v */
+    CL_CR,
+    CL_TAB,
+    CL_BS,
+    CL_FF,
+    CL_ESC,
+    CL_CSI,   /* [ */
+    CL_DIGIT,
+    CL_SEMI,
+    CL_PRIV,  /* < = > ?, private parameters */
+    CL_FINAL, /* @ to ~ */
+    CL_CLASSES
+};
+
+enum vga_action {
+    AC_NONE,
+    AC_PRINT,
+    AC_NL,
+    AC_CR,
+    AC_TAB,
+    AC_BS,
+    AC_FF,
+    AC_START, /* Begin a control sequence */
+    AC_PARAM,
+    AC_NEXT,
+    AC_PRIV,
+    AC_DISPATCH,
+};
+
+#define FSM(action, state) (( uint8_t )((action) | (ST_##state << 4)))
+
+static const uint8_t vga_fsm[ST_STATES][CL_CLASSES] = {
+        [ST_GROUND] = {
+                [CL_PRINT]    = FSM(AC_PRINT, GROUND),
+                [CL_IGNORE]   = FSM(AC_NONE, GROUND),
+                [CL_NL]       = FSM(AC_NL, GROUND),
+                [CL_CR]       = FSM(AC_CR, GROUND),
+                [CL_TAB]      = FSM(AC_TAB, GROUND),
+                [CL_BS]       = FSM(AC_BS, GROUND),
+                [CL_FF]       = FSM(AC_FF, GROUND),
+                [CL_ESC]      = FSM(AC_NONE, ESC),
+                [CL_CSI]      = FSM(AC_PRINT, GROUND),
+                [CL_DIGIT]    = FSM(AC_PRINT, GROUND),
+                [CL_SEMI]     = FSM(AC_PRINT, GROUND),
+                [CL_PRIV]     = FSM(AC_PRINT, GROUND),
+                [CL_FINAL]    = FSM(AC_PRINT, GROUND),
+        },
+        /* Only CSI is recognised after an ESC. Controls still take effect in
+         * the middle of a sequence. */
+        [ST_ESC] = {
+                [CL_PRINT]    = FSM(AC_NONE, GROUND),
+                [CL_IGNORE]   = FSM(AC_NONE, ESC),
+                [CL_NL]       = FSM(AC_NL, ESC),
+                [CL_CR]       = FSM(AC_CR, ESC),
+                [CL_TAB]      = FSM(AC_TAB, ESC),
+                [CL_BS]       = FSM(AC_BS, ESC),
+                [CL_FF]       = FSM(AC_FF, ESC),
+                [CL_ESC]      = FSM(AC_NONE, ESC),
+                [CL_CSI]      = FSM(AC_START, CSI),
+                [CL_DIGIT]    = FSM(AC_NONE, GROUND),
+                [CL_SEMI]     = FSM(AC_NONE, GROUND),
+                [CL_PRIV]     = FSM(AC_NONE, GROUND),
+                [CL_FINAL]    = FSM(AC_NONE, GROUND),
+        },
+        [ST_CSI] = {
+                [CL_PRINT]    = FSM(AC_NONE, GROUND),
+                [CL_IGNORE]   = FSM(AC_NONE, CSI),
+                [CL_NL]       = FSM(AC_NL, CSI),
+                [CL_CR]       = FSM(AC_CR, CSI),
+                [CL_TAB]      = FSM(AC_TAB, CSI),
+                [CL_BS]       = FSM(AC_BS, CSI),
+                [CL_FF]       = FSM(AC_FF, CSI),
+                [CL_ESC]      = FSM(AC_NONE, ESC),
+                [CL_CSI]      = FSM(AC_NONE, GROUND),
+                [CL_DIGIT]    = FSM(AC_PARAM, CSI),
+                [CL_SEMI]     = FSM(AC_NEXT, CSI),
+                [CL_PRIV]     = FSM(AC_PRIV, CSI),
+                [CL_FINAL]    = FSM(AC_DISPATCH, GROUND),
+        },
+};
+
+static uint8_t vga_class(unsigned char c)
+{
+    switch (c) {
+    case '\n':
+    case '\v':
+        return CL_NL;
+    case '\r':
+        return CL_CR;
+    case '\t':
+        return CL_TAB;
+    case '\b':
+        return CL_BS;
+    case '\f':
+        return CL_FF;
+    case 0x1B:
+        return CL_ESC;
+    case '[':
+        return CL_CSI;
+    case ';':
+        return CL_SEMI;
+    }
+    if (c < 0x20)
+        return CL_IGNORE;
+    if (c >= '0' && c <= '9')
+        return CL_DIGIT;
+    if (c >= '<' && c <= '?')
+        return CL_PRIV;
+    if (c >= '@' && c <= '~')
+        return CL_FINAL;
+    return CL_PRINT;
+}
+
+#define CSI_PARAMS 8
+
+/* A control sequence being parsed, kept across writes since a sequence may
+ * be split between them */
+static uint8_t  vga_state;
+static uint8_t  csi_count; /* Parameters started so far */
+static uint8_t  csi_private;
+static uint16_t csi_param[CSI_PARAMS];
+
+/* ANSI colour order to the VGA palette */
+static const uint8_t sgr_colour[8] = {0, 4, 2, 6, 1, 5, 3, 7};
+
+static size_t csi_arg(size_t i, size_t def)
+{
+    return i < csi_count && csi_param[i] ? csi_param[i] : def;
+}
+
+uint8_t vga_sgr_attr(uint8_t attr, uint8_t base, const uint16_t *param,
+                     size_t count)
+{
+    uint8_t fg = attr & 0x0F;
+    uint8_t bg = attr >> 4;
+
+    for (size_t i = 0; i < count || i == 0; ++i) {
+        unsigned p = i < count ? param[i] : 0;
+        if (p == 0) {
+            fg = base & 0x0F;
+            bg = base >> 4;
+        } else if (p == 1) {
+            fg |= 0x08;
+        } else if (p == 22) {
+            fg &= 0x07;
+        } else if (p >= 30 && p <= 37) {
+            fg = sgr_colour[p - 30] | (fg & 0x08);
+        } else if (p == 39) {
+            fg = base & 0x0F;
+        } else if (p >= 40 && p <= 47) {
+            bg = sgr_colour[p - 40];
+        } else if (p == 49) {
+            bg = base >> 4;
+        } else if (p >= 90 && p <= 97) {
+            fg = sgr_colour[p - 90] | 0x08;
+        } else if (p >= 100 && p <= 107) {
+            bg = sgr_colour[p - 100] | 0x08;
         }
     }
+    return ( uint8_t )(fg | (bg << 4));
 }
 
+/* Parameters past CSI_PARAMS were counted but not kept */
+static void vga_sgr(void)
+{
+    vga_colour = vga_sgr_attr(vga_colour, vga_base, csi_param,
+                              csi_count < CSI_PARAMS ? csi_count : CSI_PARAMS);
+}
+
+static void vga_dispatch(unsigned char final)
+{
+    const size_t col = vga_column < VGA_WIDTH ? vga_column : VGA_WIDTH - 1;
+    const size_t at  = vga_row * VGA_WIDTH + col;
+    size_t       n   = csi_arg(0, 1);
+
+    if (csi_private)
+        return;
+    switch (final) {
+    case 'm':
+        vga_sgr();
+        break;
+    case 'A':
+        vga_row    = n < vga_row ? vga_row - n : 0;
+        vga_column = col;
+        break;
+    case 'B':
+        vga_row    = vga_row + n < VGA_HEIGHT ? vga_row + n : VGA_HEIGHT - 1;
+        vga_column = col;
+        break;
+    case 'C':
+        vga_column = col + n < VGA_WIDTH ? col + n : VGA_WIDTH - 1;
+        break;
+    case 'D':
+        vga_column = n < col ? col - n : 0;
+        break;
+    case 'H':
+    case 'f':
+        vga_row    = csi_arg(0, 1) - 1;
+        vga_column = csi_arg(1, 1) - 1;
+        if (vga_row >= VGA_HEIGHT)
+            vga_row = VGA_HEIGHT - 1;
+        if (vga_column >= VGA_WIDTH)
+            vga_column = VGA_WIDTH - 1;
+        break;
+    case 'J':
+        n = csi_arg(0, 0);
+        if (n == 0)
+            vga_erase(at, VGA_CELLS);
+        else if (n == 1)
+            vga_erase(0, at + 1);
+        else if (n == 2)
+            vga_erase(0, VGA_CELLS);
+        break;
+    case 'K':
+        n = csi_arg(0, 0);
+        if (n == 0)
+            vga_erase(at, (vga_row + 1) * VGA_WIDTH);
+        else if (n == 1)
+            vga_erase(vga_row * VGA_WIDTH, at + 1);
+        else if (n == 2)
+            vga_erase(vga_row * VGA_WIDTH, (vga_row + 1) * VGA_WIDTH);
+        break;
+    }
+}
+
+static void vga_control(unsigned char c)
+{
+    const uint8_t next = vga_fsm[vga_state][vga_class(c)];
+
+    vga_state = next >> 4;
+    switch (next & 0x0F) {
+    case AC_PRINT:
+        vga_put_run(( const char * )&c, 1);
+        break;
+    case AC_NL:
+        vga_newline();
+        break;
+    case AC_CR:
+        vga_column = 0;
+        break;
+    case AC_TAB: {
+        size_t stop;
+        if (vga_column == VGA_WIDTH)
+            vga_newline();
+        stop = (vga_column | 7) + 1;
+        if (stop > VGA_WIDTH)
+            stop = VGA_WIDTH;
+        /* Blanked so a background colour shows through */
+        vga_erase(vga_row * VGA_WIDTH + vga_column, vga_row * VGA_WIDTH + stop);
+        vga_column = stop;
+        break;
+    }
+    case AC_BS:
+        if (vga_column == VGA_WIDTH)
+            vga_column--;
+        if (vga_column)
+            vga_column--;
+        break;
+    case AC_FF:
+        vga_erase(0, VGA_CELLS);
+        vga_row    = 0;
+        vga_column = 0;
+        break;
+    case AC_START:
+        csi_count    = 0;
+        csi_private  = 0;
+        csi_param[0] = 0;
+        break;
+    case AC_PARAM:
+        if (!csi_count)
+            csi_count = 1;
+        if (csi_count <= CSI_PARAMS && csi_param[csi_count - 1] < 10000)
+            csi_param[csi_count - 1] =
+                    ( uint16_t )(csi_param[csi_count - 1] * 10 + (c - '0'));
+        break;
+    case AC_NEXT:
+        if (!csi_count)
+            csi_count = 1;
+        if (csi_count < CSI_PARAMS)
+            csi_param[csi_count] = 0;
+        csi_count++;
+        break;
+    case AC_PRIV:
+        csi_private = 1;
+        break;
+    case AC_DISPATCH:
+        if (csi_count > CSI_PARAMS)
+            csi_count = CSI_PARAMS;
+        vga_dispatch(c);
+        break;
+    }
+}
+
+typedef uint64_t u64_u __attribute__((__aligned__(1), __may_alias__));
+
+#define ONES (~( uint64_t )0 / 0xFF)
+
+/* How many bytes at the start of data are printable, a word at a time. A
+ * byte below 0x20 is the only kind to borrow from its top bit in x - 0x20..
+ * without having it set in x. Borrows only run upwards, so the lowest flagged
+ * byte, the first in memory, is always a real one. */
+static size_t vga_printable(const char *data, size_t size)
+{
+    size_t n = 0;
+
+    for (; n + 8 <= size; n += 8) {
+        uint64_t x    = *( const u64_u * )(data + n);
+        uint64_t ctrl = (x - ONES * 0x20) & ~x & (ONES * 0x80);
+        if (ctrl)
+            return n + (( size_t )__builtin_ctzll(ctrl) >> 3);
+    }
+    while (n < size && ( unsigned char )data[n] >= 0x20)
+        ++n;
+    return n;
+}
+
+void vga_putchar(char c) { vga_write(&c, 1); }
+
+/* Printable runs are found a word at a time and copied in bulk, only control
+ * bytes and escape sequences go through the state machine. What changed is
+ * pushed to the screen once for the whole write. */
 void vga_write(const char *data, size_t size)
 {
-    for (size_t i = 0; i < size; ++i)
-        vga_putchar(data[i]);
+    while (size) {
+        size_t run = vga_state == ST_GROUND ? vga_printable(data, size) : 0;
+        if (run) {
+            vga_put_run(data, run);
+        } else {
+            vga_control(( unsigned char )*data);
+            run = 1;
+        }
+        data += run;
+        size -= run;
+    }
+    vga_flush();
 }
 
 void vga_writes(const char *data) { vga_write(data, strlen(data)); }